@@ -2,8 +2,10 @@
 # config/make/linux-common.mk
 #
 
+# SSE2 is required on x86, as on x64 where it is part of the base instruction set
+
 ifeq ($(TARGET_ARCHITECTURE), x86)
-	INTERNAL_TARGET_ARCHITECTURE = -m32
+	INTERNAL_TARGET_ARCHITECTURE = -m32 -msse2
 else ifeq ($(TARGET_ARCHITECTURE), x64)
 	INTERNAL_TARGET_ARCHITECTURE = -m64
 else
@@ -22,9 +22,11 @@
 
 #include <content/ContentLoader.h>
 #include <core/FileStream.h>
-#include <core/Map.h>
+#include <core/FlatMap.h>
 #include <core/Memory.h>
+#include <core/Name.h>
 #include <core/String.h>
+#include <core/StringView.h>
 
 namespace Content
 {
@@ -45,21 +47,26 @@ namespace Content
 
 		inline void setContentRootDirectory(const Core::String8& directoryPath);
 
+		/**
+		 * Loads the content at the filepath relative to the content root
+		 * directory, or returns it if it is already loaded.
+		 */
 		template<typename T>
-		T* load(const Core::String8& filepath);
+		T* load(const Core::StringView8& filepath);
 
 		ContentManager& operator =(const ContentManager& contentManager) = delete;
 		ContentManager& operator =(ContentManager&& contentManager) = delete;
 
 	private:
 
-		using ContentMap = Core::Map<Core::String8, ContentBase*>;
+		using ContentMap = Core::FlatMap<Core::Name, ContentBase*>;
 
 		Core::String8 _contentRootDirectory;
+		Core::String8 _filepathBuffer;
 		ContentMap _loadedContent;
 
 		template<typename T>
-		T* loadContent(const Core::String8& filepath);
+		T* loadContent(const Core::Name& name, const Core::String8& filepath);
 	};
 
 #include "inline/ContentManager.inl"
@@ -31,13 +31,18 @@ void ContentManager::setContentRootDirectory(const Core::String8& directoryPath)
 }
 
 template<typename T>
-T* ContentManager::load(const Core::String8& filepath)
+T* ContentManager::load(const Core::StringView8& filepath)
 {
-	const Core::String8 contentFilepath(_contentRootDirectory + filepath);
-	ContentMap::iterator iterator = _loadedContent.find(contentFilepath);
+	// The full filepath is built in a reused buffer, so a lookup of loaded
+	// content does not allocate
+
+	_filepathBuffer.assign(_contentRootDirectory);
+	_filepathBuffer.append(filepath.data(), filepath.size());
+	const Core::Name name(_filepathBuffer);
+	ContentMap::iterator iterator = _loadedContent.find(name);
 
 	if(iterator == _loadedContent.end())
-		return loadContent<T>(contentFilepath);
+		return loadContent<T>(name, _filepathBuffer);
 
 	return static_cast<T*>(iterator->second);
 }
@@ -45,12 +50,12 @@ T* ContentManager::load(const Core::String8& filepath)
 // Private
 
 template<typename T>
-T* ContentManager::loadContent(const Core::String8& filepath)
+T* ContentManager::loadContent(const Core::Name& name, const Core::String8& filepath)
 {
 	Core::FileStream fileStream(filepath);
 	ContentLoader<T>* contentLoader = ContentLoader<T>::createLoader();
 	T* content = contentLoader->load(fileStream);
-	_loadedContent[filepath] = content;
+	_loadedContent[name] = content;
 	DE_DELETE(contentLoader, ContentLoader<T>);
 
 	return content;
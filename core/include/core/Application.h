@@ -21,7 +21,9 @@
 #pragma once
 
 #include <core/ConfigInternal.h>
+#include <core/JobSystem.h>
 #include <core/LogManager.h>
+#include <core/NameTable.h>
 #include <core/Singleton.h>
 
 #if defined(DE_INTERNAL_CONFIG_TRACK_ALLOCATIONS)
@@ -55,5 +57,7 @@ namespace Core
 #endif
 
 		LogManager _logManager;
+		NameTable _nameTable;
+		JobSystem _jobSystem;
 	};
 }
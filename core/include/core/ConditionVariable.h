@@ -0,0 +1,71 @@
+/**
+ * @file core/ConditionVariable.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/ContentionCounter.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	class Mutex;
+
+	class ConditionVariable final
+	{
+	public:
+
+		ConditionVariable();
+
+		ConditionVariable(const ConditionVariable& conditionVariable) = delete;
+		ConditionVariable(ConditionVariable&& conditionVariable) = delete;
+
+		~ConditionVariable() = default;
+
+		/**
+		 * Gets the number of times a thread has waited for the condition
+		 * variable.
+		 */
+		inline Uint32 contentionCount() const;
+
+		void notifyAll();
+
+		void notifyOne();
+
+		inline void resetContentionCount();
+
+		/**
+		 * Unlocks the mutex and blocks the calling thread until notified,
+		 * locking the mutex again before returning. The thread may also wake
+		 * spuriously, so the condition must be checked in a loop.
+		 */
+		void wait(Mutex& mutex);
+
+		ConditionVariable& operator =(const ConditionVariable& conditionVariable) = delete;
+		ConditionVariable& operator =(ConditionVariable&& conditionVariable) = delete;
+
+	private:
+
+		std::atomic<Uint32> _sequence;
+		ContentionCounter _contentionCounter;
+	};
+
+#include "inline/ConditionVariable.inl"
+}
@@ -35,9 +35,35 @@
  */
 #define DE_CONFIG_TRACK_ALLOCATIONS
 
+/**
+ * If defined, the synchronisation primitives (see core/Mutex.h, for example)
+ * count how many times a thread had to wait for them in debug and release
+ * builds.
+ */
+#define DE_CONFIG_TRACK_CONTENTION
+
 
 namespace Config
 {
+	/**
+	 * The number of jobs each thread of Core::JobSystem can have in flight.
+	 * Must be a power of two.
+	 */
+	constexpr Uint32 JOB_SYSTEM_MAX_JOB_COUNT = 4096u;
+
+	/**
+	 * The number of times an idle thread of Core::JobSystem looks for a job
+	 * before it goes to sleep.
+	 */
+	constexpr Uint32 JOB_SYSTEM_SPIN_COUNT = 64u;
+
+	/**
+	 * The number of worker threads Core::JobSystem creates. If zero, a worker
+	 * is created for each hardware thread except the one used by the thread
+	 * initialising the system.
+	 */
+	constexpr Uint32 JOB_SYSTEM_WORKER_COUNT = 0u;
+
 	constexpr Uint32 LOG_BUFFER_SIZE = 1024u;
 
 	constexpr Uint32 LOG_LINE_MAX_WIDTH = 120u;
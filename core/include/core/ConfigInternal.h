@@ -30,3 +30,7 @@
 #if defined(DE_INTERNAL_BUILD_DEVELOPMENT) && defined(DE_CONFIG_TRACK_ALLOCATIONS)
 	#define DE_INTERNAL_CONFIG_TRACK_ALLOCATIONS
 #endif
+
+#if defined(DE_INTERNAL_BUILD_DEVELOPMENT) && defined(DE_CONFIG_TRACK_CONTENTION)
+	#define DE_INTERNAL_CONFIG_TRACK_CONTENTION
+#endif
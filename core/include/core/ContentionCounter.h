@@ -0,0 +1,62 @@
+/**
+ * @file core/ContentionCounter.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/ConfigInternal.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Counts how many times threads had to wait for a synchronisation
+	 * primitive. Does nothing unless DE_CONFIG_TRACK_CONTENTION is defined
+	 * in a development build.
+	 */
+	class ContentionCounter final
+	{
+	public:
+
+		inline ContentionCounter();
+
+		ContentionCounter(const ContentionCounter& contentionCounter) = delete;
+		ContentionCounter(ContentionCounter&& contentionCounter) = delete;
+
+		~ContentionCounter() = default;
+
+		inline void increment();
+
+		inline void reset();
+
+		inline Uint32 value() const;
+
+		ContentionCounter& operator =(const ContentionCounter& contentionCounter) = delete;
+		ContentionCounter& operator =(ContentionCounter&& contentionCounter) = delete;
+
+	private:
+
+#if defined(DE_INTERNAL_CONFIG_TRACK_CONTENTION)
+		std::atomic<Uint32> _value;
+#endif
+	};
+
+#include "inline/ContentionCounter.inl"
+}
@@ -0,0 +1,86 @@
+/**
+ * @file core/Event.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/ContentionCounter.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	enum class EventResetMode
+	{
+		/**
+		 * The event is reset when it releases a single waiting thread.
+		 */
+		Automatic,
+
+		/**
+		 * The event stays set, releasing all waiting threads, until reset.
+		 */
+		Manual
+	};
+
+	class Event final
+	{
+	public:
+
+		explicit Event(const EventResetMode& resetMode, const Bool isSet = false);
+
+		Event(const Event& event) = delete;
+		Event(Event&& event) = delete;
+
+		~Event() = default;
+
+		/**
+		 * Gets the number of times a thread had to wait for the event.
+		 */
+		inline Uint32 contentionCount() const;
+
+		inline Bool isSet() const;
+
+		void reset();
+
+		inline void resetContentionCount();
+
+		void set();
+
+		/**
+		 * Checks whether the event is set without blocking. An automatic
+		 * reset event is reset if it was set.
+		 */
+		Bool tryWait();
+
+		void wait();
+
+		Event& operator =(const Event& event) = delete;
+		Event& operator =(Event&& event) = delete;
+
+	private:
+
+		std::atomic<Uint32> _state;
+		std::atomic<Uint32> _waiterCount;
+		ContentionCounter _contentionCounter;
+		EventResetMode _resetMode;
+	};
+
+#include "inline/Event.inl"
+}
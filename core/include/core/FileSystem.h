@@ -42,6 +42,17 @@ namespace Core
 
 		static String8 getFileExtension(const String8 filepath);
 
+		/**
+		 * Checks whether the file exists and can be opened for reading.
+		 */
+		static Bool isReadable(const String8& filepath);
+
+		/**
+		 * Checks whether the file or directory exists and can be written to.
+		 * Files can be created in a writable directory.
+		 */
+		static Bool isWritable(const String8& path);
+
 		FileSystem& operator =(const FileSystem& fileSystem) = delete;
 		FileSystem& operator =(FileSystem&& fileSystem) = delete;
 	};
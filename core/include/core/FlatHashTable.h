@@ -0,0 +1,206 @@
+/**
+ * @file core/FlatHashTable.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <emmintrin.h>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <core/Platform.h>
+#include <core/Types.h>
+#include <core/debug/Assert.h>
+
+#if DE_COMPILER == DE_COMPILER_MSVC
+	#include <intrin.h>
+#endif
+
+namespace Core
+{
+	/**
+	 * Matches control bytes of a 16-slot group in FlatHashTable using SSE2
+	 */
+	class FlatHashTableGroup final
+	{
+	public:
+
+		static const Uint32 SIZE = 16u;
+
+		static const Int8 CONTROL_EMPTY	  = -128;
+		static const Int8 CONTROL_DELETED = -2;
+
+		inline explicit FlatHashTableGroup(const Int8* control);
+
+		FlatHashTableGroup(const FlatHashTableGroup& group) = default;
+		FlatHashTableGroup(FlatHashTableGroup&& group) = default;
+
+		~FlatHashTableGroup() = default;
+
+		/**
+		 * Gets a bitmask of the slots with the given hash fragment.
+		 */
+		inline Uint32 match(const Int8 hashFragment) const;
+
+		inline Uint32 matchEmpty() const;
+
+		inline Uint32 matchEmptyOrDeleted() const;
+
+		FlatHashTableGroup& operator =(const FlatHashTableGroup& group) = default;
+		FlatHashTableGroup& operator =(FlatHashTableGroup&& group) = default;
+
+		static inline Uint32 countTrailingZeros(const Uint32 mask);
+
+	private:
+
+		__m128i _control;
+	};
+
+	/**
+	 * Open addressing hash table, which stores the values in a flat array
+	 * split into groups of 16 slots. Each slot has a control byte holding 7
+	 * bits of the hash of its key, so a group is probed with a few SIMD
+	 * instructions and the keys are compared only on a hash match.
+	 *
+	 * Inserting may move the values, which invalidates pointers, references
+	 * and iterators. Erasing invalidates only the erased values.
+	 *
+	 * Used through FlatMap and FlatSet.
+	 */
+	template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+		typename Allocator>
+	class FlatHashTable
+	{
+	private:
+
+		template<typename IteratorValue>
+		class IteratorTemplate;
+
+	public:
+
+		using allocator_type  = Allocator;
+		using const_iterator  = IteratorTemplate<const Value>;
+		using const_reference = const Value&;
+		using difference_type = Int;
+		using hasher		  = Hash;
+		using iterator		  = IteratorTemplate<Value>;
+		using key_equal		  = KeyEqual;
+		using key_type		  = Key;
+		using reference		  = Value&;
+		using size_type		  = Uint;
+		using value_type	  = Value;
+
+		explicit FlatHashTable(const Uint capacity = 0u, const Hash& hash = Hash(),
+			const KeyEqual& keyEqual = KeyEqual(), const Allocator& allocator = Allocator());
+
+		FlatHashTable(const FlatHashTable& table);
+
+		FlatHashTable(FlatHashTable&& table);
+
+		~FlatHashTable();
+
+		inline iterator begin();
+
+		inline const_iterator begin() const;
+
+		inline Uint capacity() const;
+
+		inline const_iterator cbegin() const;
+
+		inline const_iterator cend() const;
+
+		void clear();
+
+		inline Uint count(const Key& key) const;
+
+		inline Bool empty() const;
+
+		inline iterator end();
+
+		inline const_iterator end() const;
+
+		iterator erase(const_iterator position);
+
+		Uint erase(const Key& key);
+
+		inline iterator find(const Key& key);
+
+		inline const_iterator find(const Key& key) const;
+
+		inline Float32 load_factor() const;
+
+		void reserve(const Uint count);
+
+		inline Uint size() const;
+
+		FlatHashTable& operator =(const FlatHashTable& table);
+
+		FlatHashTable& operator =(FlatHashTable&& table);
+
+	protected:
+
+		/**
+		 * Constructs a value from the parameters if the key is not in the
+		 * table yet. The key must equal the key of the constructed value.
+		 */
+		template<typename... Parameters>
+		std::pair<iterator, Bool> emplaceUnique(const Key& key, Parameters&&... parameters);
+
+	private:
+
+		using ByteAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Uint8>;
+
+		Int8* _control;
+		Value* _slots;
+		Uint _capacity;
+		Uint _size;
+		Uint _growthLeft;
+		Hash _hash;
+		KeyEqual _keyEqual;
+		ByteAllocator _allocator;
+
+		Void* allocate(const Uint capacity);
+
+		void deallocate();
+
+		void destroyValues();
+
+		Uint findIndex(const Key& key, const Uint hash) const;
+
+		Uint findInsertIndex(const Uint hash) const;
+
+		Uint hashKey(const Key& key) const;
+
+		void rehash(const Uint capacity);
+
+		void setControl(const Uint index, const Int8 control);
+
+		static inline Uint allocationSize(const Uint capacity);
+
+		static inline Uint maxSize(const Uint capacity);
+
+		static inline Uint slotOffset(const Uint capacity);
+
+		static inline Void* toVoidPointer(Value* value);
+	};
+
+#include "inline/FlatHashTable.inl"
+}
@@ -0,0 +1,86 @@
+/**
+ * @file core/FlatMap.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <core/FlatHashTable.h>
+#include <core/memory/STDAllocator.h>
+
+namespace Core
+{
+	template<typename Key, typename T>
+	struct FlatMapKeyExtractor final
+	{
+		static inline const Key& key(const std::pair<const Key, T>& value);
+	};
+
+	/**
+	 * Unordered map for storing key-value pairs with unique keys, which keeps
+	 * the pairs in a flat open addressing table. Faster to look up and iterate
+	 * than Map, but inserting invalidates pointers and references to the
+	 * pairs.
+	 */
+	template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+		typename Allocator = Memory::STDAllocator<std::pair<const Key, T>>>
+	class FlatMap final
+		: public FlatHashTable<std::pair<const Key, T>, Key, FlatMapKeyExtractor<Key, T>, Hash, KeyEqual,
+			  Allocator>
+	{
+	private:
+
+		using Base = FlatHashTable<std::pair<const Key, T>, Key, FlatMapKeyExtractor<Key, T>, Hash, KeyEqual,
+			Allocator>;
+
+	public:
+
+		using iterator	  = typename Base::iterator;
+		using mapped_type = T;
+		using value_type  = typename Base::value_type;
+
+		explicit FlatMap(const Uint capacity = 0u, const Hash& hash = Hash(), const KeyEqual& keyEqual = KeyEqual(),
+			const Allocator& allocator = Allocator());
+
+		FlatMap(const FlatMap& map) = default;
+		FlatMap(FlatMap&& map) = default;
+
+		~FlatMap() = default;
+
+		/**
+		 * Constructs the mapped value from the parameters if the key is not in
+		 * the map yet.
+		 */
+		template<typename... Parameters>
+		inline std::pair<iterator, Bool> emplace(const Key& key, Parameters&&... parameters);
+
+		inline std::pair<iterator, Bool> insert(const value_type& value);
+
+		inline std::pair<iterator, Bool> insert(value_type&& value);
+
+		FlatMap& operator =(const FlatMap& map) = default;
+		FlatMap& operator =(FlatMap&& map) = default;
+
+		inline T& operator [](const Key& key);
+	};
+
+#include "inline/FlatMap.inl"
+}
@@ -0,0 +1,78 @@
+/**
+ * @file core/FlatSet.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <core/FlatHashTable.h>
+#include <core/memory/STDAllocator.h>
+
+namespace Core
+{
+	template<typename Key>
+	struct FlatSetKeyExtractor final
+	{
+		static inline const Key& key(const Key& value);
+	};
+
+	/**
+	 * Unordered set for storing unique keys, which keeps the keys in a flat
+	 * open addressing table. Faster to look up and iterate than Set, but
+	 * inserting invalidates pointers and references to the keys.
+	 */
+	template<typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+		typename Allocator = Memory::STDAllocator<Key>>
+	class FlatSet final
+		: public FlatHashTable<const Key, Key, FlatSetKeyExtractor<Key>, Hash, KeyEqual, Allocator>
+	{
+	private:
+
+		using Base = FlatHashTable<const Key, Key, FlatSetKeyExtractor<Key>, Hash, KeyEqual, Allocator>;
+
+	public:
+
+		using iterator = typename Base::iterator;
+
+		explicit FlatSet(const Uint capacity = 0u, const Hash& hash = Hash(), const KeyEqual& keyEqual = KeyEqual(),
+			const Allocator& allocator = Allocator());
+
+		FlatSet(const FlatSet& set) = default;
+		FlatSet(FlatSet&& set) = default;
+
+		~FlatSet() = default;
+
+		/**
+		 * Constructs a key from the parameters and inserts it if it is not in
+		 * the set yet.
+		 */
+		template<typename... Parameters>
+		inline std::pair<iterator, Bool> emplace(Parameters&&... parameters);
+
+		inline std::pair<iterator, Bool> insert(const Key& key);
+
+		inline std::pair<iterator, Bool> insert(Key&& key);
+
+		FlatSet& operator =(const FlatSet& set) = default;
+		FlatSet& operator =(FlatSet&& set) = default;
+	};
+
+#include "inline/FlatSet.inl"
+}
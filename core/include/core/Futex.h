@@ -0,0 +1,56 @@
+/**
+ * @file core/Futex.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Waiting on the address of a value, which the synchronisation primitives
+	 * are built on. Uses futexes on Linux and WaitOnAddress() on Windows.
+	 */
+	class Futex final
+	{
+	public:
+
+		Futex() = delete;
+
+		Futex(const Futex& futex) = delete;
+		Futex(Futex&& futex) = delete;
+
+		~Futex() = delete;
+
+		/**
+		 * Blocks the calling thread if the value equals expectedValue, until
+		 * another thread wakes it. May return spuriously.
+		 */
+		static void wait(std::atomic<Uint32>& value, const Uint32 expectedValue);
+
+		static void wakeAll(std::atomic<Uint32>& value);
+
+		static void wakeOne(std::atomic<Uint32>& value);
+
+		Futex& operator =(const Futex& futex) = delete;
+		Futex& operator =(Futex&& futex) = delete;
+	};
+}
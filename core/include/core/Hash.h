@@ -0,0 +1,42 @@
+/**
+ * @file core/Hash.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Hashes a byte array with a fast, well-distributed 64-bit hash function
+	 * from the wyhash family. Equal byte arrays have equal hashes regardless
+	 * of the type they are stored as.
+	 *
+	 * @param data
+	 *   The bytes to hash
+	 * @param size
+	 *   The number of bytes
+	 * @param seed
+	 *   The seed of the hash
+	 * @return
+	 *   The hash of the bytes
+	 */
+	Uint64 hashBytes(const Void* data, const Uint size, const Uint64 seed = 0u);
+}
@@ -0,0 +1,129 @@
+/**
+ * @file core/JobSystem.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Singleton.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	class Job;
+	class Thread;
+
+	/**
+	 * Work-stealing job system. Each worker thread and the thread which
+	 * initialised the system own a job queue. A thread pushes jobs to its own
+	 * queue and steals from the others when its queue runs empty.
+	 *
+	 * Jobs are allocated from per-thread ring pools, so a single thread must
+	 * not have more than Config::JOB_SYSTEM_MAX_JOB_COUNT jobs in flight. A
+	 * job counts as in flight from its creation until it has finished, and
+	 * its slot is reused afterwards, so a finished job must not be waited for
+	 * once the thread has created that many jobs since. Only the worker
+	 * threads and the thread which initialised the system may use it.
+	 */
+	class JobSystem final : public Singleton<JobSystem>
+	{
+	public:
+
+		using JobFunction = void (*)(Void* parameter);
+		using ParallelForFunction = void (*)(const Uint32 begin, const Uint32 end, Void* parameter);
+
+		JobSystem();
+
+		JobSystem(const JobSystem& jobSystem) = delete;
+		JobSystem(JobSystem&& jobSystem) = delete;
+
+		~JobSystem() = default;
+
+		/**
+		 * Creates a job. The job must be passed to run() before waiting for it.
+		 *
+		 * @param function
+		 *   The function to execute
+		 * @param parameter
+		 *   The parameter passed to the function
+		 * @param parent
+		 *   The parent job, or nullptr. The parent is not finished until all of
+		 *   its children have finished. Children must be created before the
+		 *   parent finishes, i.e. before running it or from its function.
+		 */
+		Job* createJob(JobFunction function, Void* parameter, Job* parent = nullptr);
+
+		void deinitialise();
+
+		void initialise();
+
+		/**
+		 * Checks whether the job and all of its children have finished.
+		 */
+		Bool isFinished(const Job* job) const;
+
+		/**
+		 * Calls the function for the range [0, count) in batches of at most
+		 * batchSize elements, spreading the batches over the worker threads.
+		 * Returns after all the batches have been processed.
+		 */
+		void parallelFor(const Uint32 count, const Uint32 batchSize, ParallelForFunction function,
+			Void* parameter);
+
+		/**
+		 * Queues the job for execution.
+		 */
+		void run(Job* job);
+
+		/**
+		 * Waits for the job to finish. The calling thread executes other jobs
+		 * while waiting and sleeps once it runs out of them.
+		 */
+		void wait(const Job* job);
+
+		inline Uint32 workerCount() const;
+
+		JobSystem& operator =(const JobSystem& jobSystem) = delete;
+		JobSystem& operator =(JobSystem&& jobSystem) = delete;
+
+	private:
+
+		class Queue;
+
+		Job* _jobs;
+		Queue* _queues;
+		Thread* _workers;
+		Uint32 _workerCount;
+
+		Job* allocateJob();
+
+		void execute(Job* job);
+
+		void finish(Job* job);
+
+		Job* getJob();
+
+		Job* stealJob();
+
+		static void parallelForJob(Void* parameter);
+
+		static Int32 workerEntry(Void* parameter);
+	};
+
+#include "inline/JobSystem.inl"
+}
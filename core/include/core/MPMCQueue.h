@@ -0,0 +1,94 @@
+/**
+ * @file core/MPMCQueue.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+#include <core/Array.h>
+#include <core/Memory.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Bounded lock-free multi-producer multi-consumer queue. Any number of
+	 * threads may push and pop concurrently.
+	 *
+	 * T must be default-constructible and movable. Capacity must be a power
+	 * of two.
+	 */
+	template<typename T, Uint32 Capacity>
+	class MPMCQueue final
+	{
+	public:
+
+		MPMCQueue();
+
+		MPMCQueue(const MPMCQueue& queue) = delete;
+		MPMCQueue(MPMCQueue&& queue) = delete;
+
+		~MPMCQueue() = default;
+
+		inline Uint32 capacity() const;
+
+		/**
+		 * Pops the next value into value. Returns false if the queue is empty.
+		 */
+		Bool tryPop(T& value);
+
+		/**
+		 * Pushes a value. Returns false if the queue is full.
+		 */
+		Bool tryPush(const T& value);
+
+		Bool tryPush(T&& value);
+
+		MPMCQueue& operator =(const MPMCQueue& queue) = delete;
+		MPMCQueue& operator =(MPMCQueue&& queue) = delete;
+
+	private:
+
+		static_assert(Capacity > 0u && (Capacity & (Capacity - 1u)) == 0u, "Capacity must be a power of two.");
+
+		static const Uint32 INDEX_MASK = Capacity - 1u;
+
+		/**
+		 * The sequence tells whether the cell is ready to be written or read
+		 * for a given queue position.
+		 */
+		struct Cell
+		{
+			std::atomic<Uint32> sequence;
+			T value;
+		};
+
+		std::atomic<Uint32> _enqueuePosition;
+		Uint8 _enqueuePadding[CACHE_LINE_SIZE - sizeof(std::atomic<Uint32>)];
+		std::atomic<Uint32> _dequeuePosition;
+		Uint8 _dequeuePadding[CACHE_LINE_SIZE - sizeof(std::atomic<Uint32>)];
+		Array<Cell, Capacity> _cells;
+
+		template<typename U>
+		Bool push(U&& value);
+	};
+
+#include "inline/MPMCQueue.inl"
+}
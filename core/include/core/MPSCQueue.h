@@ -0,0 +1,99 @@
+/**
+ * @file core/MPSCQueue.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/Memory.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Base class for the elements of MPSCQueue
+	 */
+	class MPSCQueueNode
+	{
+	public:
+
+		MPSCQueueNode()
+			: _next(nullptr) { }
+
+		MPSCQueueNode(const MPSCQueueNode& node) = delete;
+		MPSCQueueNode(MPSCQueueNode&& node) = delete;
+
+		~MPSCQueueNode() = default;
+
+		MPSCQueueNode& operator =(const MPSCQueueNode& node) = delete;
+		MPSCQueueNode& operator =(MPSCQueueNode&& node) = delete;
+
+	private:
+
+		template<typename T>
+		friend class MPSCQueue;
+
+		std::atomic<MPSCQueueNode*> _next;
+	};
+
+	/**
+	 * Unbounded intrusive multi-producer single-consumer queue. Any number of
+	 * threads may push, but only one thread may pop at a time. Pushing never
+	 * blocks nor allocates memory, as the elements are linked through their
+	 * MPSCQueueNode base. The queue does not own the elements.
+	 *
+	 * T must derive from MPSCQueueNode. An element can be in one queue at a
+	 * time.
+	 */
+	template<typename T>
+	class MPSCQueue final
+	{
+	public:
+
+		MPSCQueue();
+
+		MPSCQueue(const MPSCQueue& queue) = delete;
+		MPSCQueue(MPSCQueue&& queue) = delete;
+
+		~MPSCQueue() = default;
+
+		/**
+		 * Pops the oldest element, or returns nullptr if the queue is empty.
+		 * May also return nullptr while a producer is in the middle of
+		 * pushing.
+		 */
+		T* pop();
+
+		void push(T* element);
+
+		MPSCQueue& operator =(const MPSCQueue& queue) = delete;
+		MPSCQueue& operator =(MPSCQueue&& queue) = delete;
+
+	private:
+
+		std::atomic<MPSCQueueNode*> _head;
+		Uint8 _headPadding[CACHE_LINE_SIZE - sizeof(std::atomic<MPSCQueueNode*>)];
+		MPSCQueueNode* _tail;
+		MPSCQueueNode _stub;
+
+		void pushNode(MPSCQueueNode* node);
+	};
+
+#include "inline/MPSCQueue.inl"
+}
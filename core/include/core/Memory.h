@@ -43,7 +43,7 @@
 
 #define DE_DELETE_ARRAY(pointer, T, size) \
 	if((pointer) != nullptr) { Core::destructArray<T>(pointer, size); \
-		Core::deallocateMemory(pointer, size); }
+		Core::deallocateMemory(pointer, sizeof(T) * (size)); }
 
 #if defined(DE_INTERNAL_CONFIG_TRACK_ALLOCATIONS)
 	#define DE_NEW(T) \
@@ -62,6 +62,12 @@
 
 namespace Core
 {
+	/**
+	 * The assumed size of a processor cache line. Data written by different
+	 * threads is kept this far apart to avoid false sharing.
+	 */
+	constexpr Uint32 CACHE_LINE_SIZE = 64u;
+
 	Void* allocateMemory(const Uint size, const Char8* file = nullptr, const Uint32 line = 0u,
 		const Char8* function = nullptr);
 
@@ -0,0 +1,73 @@
+/**
+ * @file core/Mutex.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/ContentionCounter.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Non-recursive mutex. Locking and unlocking an uncontended mutex does not
+	 * enter the kernel.
+	 */
+	class Mutex final
+	{
+	public:
+
+		Mutex();
+
+		Mutex(const Mutex& mutex) = delete;
+		Mutex(Mutex&& mutex) = delete;
+
+		~Mutex() = default;
+
+		/**
+		 * Gets the number of times a thread had to wait for the mutex.
+		 */
+		inline Uint32 contentionCount() const;
+
+		inline void lock();
+
+		inline void resetContentionCount();
+
+		inline Bool tryLock();
+
+		inline void unlock();
+
+		Mutex& operator =(const Mutex& mutex) = delete;
+		Mutex& operator =(Mutex&& mutex) = delete;
+
+	private:
+
+		// 0: unlocked, 1: locked, 2: locked with possible waiters
+		std::atomic<Uint32> _state;
+
+		ContentionCounter _contentionCounter;
+
+		void lockContended();
+
+		void unlockContended();
+	};
+
+#include "inline/Mutex.inl"
+}
@@ -0,0 +1,86 @@
+/**
+ * @file core/Name.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <core/NameTable.h>
+#include <core/StringView.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Handle to a string interned in NameTable. Names are compared by their
+	 * 32-bit index and hashed with the hash computed when interning, so both
+	 * take constant time regardless of the string length.
+	 *
+	 * A default-constructed name refers to the empty string.
+	 */
+	class Name final
+	{
+	public:
+
+		inline Name();
+
+		inline explicit Name(const StringView8& string);
+
+		Name(const Name& name) = default;
+		Name(Name&& name) = default;
+
+		~Name() = default;
+
+		inline Uint32 hash() const;
+
+		inline Uint32 index() const;
+
+		/**
+		 * Gets the interned string, which is null-terminated.
+		 */
+		inline StringView8 string() const;
+
+		Name& operator =(const Name& name) = default;
+		Name& operator =(Name&& name) = default;
+
+		inline Bool operator ==(const Name& name) const;
+
+		inline Bool operator !=(const Name& name) const;
+
+		inline Bool operator <(const Name& name) const;
+
+	private:
+
+		Uint32 _index;
+	};
+
+#include "inline/Name.inl"
+}
+
+namespace std
+{
+	template<>
+	struct hash<Core::Name>
+	{
+		Uint operator ()(const Core::Name& value) const
+		{
+			return value.hash();
+		}
+	};
+}
@@ -0,0 +1,105 @@
+/**
+ * @file core/NameTable.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/Array.h>
+#include <core/FlatMap.h>
+#include <core/Mutex.h>
+#include <core/Singleton.h>
+#include <core/StringView.h>
+#include <core/Types.h>
+#include <core/Vector.h>
+
+namespace Core
+{
+	/**
+	 * Thread-safe table of interned strings, which backs Name. Each distinct
+	 * string is stored once and identified by a 32-bit index. Index 0 is the
+	 * empty string. Interned strings stay valid and null-terminated until the
+	 * table is deinitialised.
+	 *
+	 * Interning locks a mutex, whereas getting the string or the hash of an
+	 * index does not.
+	 */
+	class NameTable final : public Singleton<NameTable>
+	{
+	public:
+
+		NameTable();
+
+		NameTable(const NameTable& nameTable) = delete;
+		NameTable(NameTable&& nameTable) = delete;
+
+		~NameTable() = default;
+
+		void deinitialise();
+
+		inline Uint32 hash(const Uint32 index) const;
+
+		void initialise();
+
+		/**
+		 * Gets the index of the string, adding the string to the table if it
+		 * is not interned yet.
+		 */
+		Uint32 intern(const StringView8& string);
+
+		inline Uint32 size() const;
+
+		inline StringView8 string(const Uint32 index) const;
+
+		NameTable& operator =(const NameTable& nameTable) = delete;
+		NameTable& operator =(NameTable&& nameTable) = delete;
+
+	private:
+
+		struct CharacterBlock final
+		{
+			Char8* characters;
+			Uint size;
+		};
+
+		struct Entry final
+		{
+			const Char8* characters;
+			Uint32 length;
+			Uint32 hash;
+		};
+
+		static const Uint32 CHARACTER_BLOCK_SIZE = 16384u;
+		static const Uint32 ENTRY_BLOCK_SIZE = 1024u;
+		static const Uint32 MAX_ENTRY_BLOCK_COUNT = 1024u;
+
+		Array<Entry*, MAX_ENTRY_BLOCK_COUNT> _entryBlocks;
+		Vector<CharacterBlock> _characterBlocks;
+		FlatMap<StringView8, Uint32> _indices;
+		Mutex _mutex;
+		Uint _characterBlockOffset;
+		std::atomic<Uint32> _size;
+
+		const Char8* storeCharacters(const StringView8& string);
+
+		inline const Entry& entry(const Uint32 index) const;
+	};
+
+#include "inline/NameTable.inl"
+}
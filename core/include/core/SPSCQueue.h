@@ -0,0 +1,96 @@
+/**
+ * @file core/SPSCQueue.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+#include <core/Array.h>
+#include <core/Memory.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Bounded lock-free single-producer single-consumer queue. Exactly one
+	 * thread may push and exactly one thread may pop at a time.
+	 *
+	 * T must be default-constructible and movable. Capacity must be a power
+	 * of two.
+	 */
+	template<typename T, Uint32 Capacity>
+	class SPSCQueue final
+	{
+	public:
+
+		SPSCQueue();
+
+		SPSCQueue(const SPSCQueue& queue) = delete;
+		SPSCQueue(SPSCQueue&& queue) = delete;
+
+		~SPSCQueue() = default;
+
+		inline Uint32 capacity() const;
+
+		/**
+		 * Checks whether the queue is empty. The result may be out of date by
+		 * the time it is returned, unless called by the consumer.
+		 */
+		inline Bool isEmpty() const;
+
+		/**
+		 * Pops the next value into value. Returns false if the queue is empty.
+		 */
+		Bool tryPop(T& value);
+
+		/**
+		 * Pushes a value. Returns false if the queue is full.
+		 */
+		Bool tryPush(const T& value);
+
+		Bool tryPush(T&& value);
+
+		SPSCQueue& operator =(const SPSCQueue& queue) = delete;
+		SPSCQueue& operator =(SPSCQueue&& queue) = delete;
+
+	private:
+
+		static_assert(Capacity > 0u && (Capacity & (Capacity - 1u)) == 0u, "Capacity must be a power of two.");
+
+		static const Uint32 INDEX_MASK = Capacity - 1u;
+
+		// The producer owns the tail and the consumer the head. Each keeps a
+		// cached copy of the other's index, refreshing it only when the queue
+		// seems full or empty.
+
+		std::atomic<Uint32> _head;
+		Uint32 _cachedTail;
+		Uint8 _headPadding[CACHE_LINE_SIZE - sizeof(std::atomic<Uint32>) - sizeof(Uint32)];
+		std::atomic<Uint32> _tail;
+		Uint32 _cachedHead;
+		Uint8 _tailPadding[CACHE_LINE_SIZE - sizeof(std::atomic<Uint32>) - sizeof(Uint32)];
+		Array<T, Capacity> _values;
+
+		template<typename U>
+		Bool push(U&& value);
+	};
+
+#include "inline/SPSCQueue.inl"
+}
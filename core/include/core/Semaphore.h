@@ -0,0 +1,69 @@
+/**
+ * @file core/Semaphore.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/ContentionCounter.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	class Semaphore final
+	{
+	public:
+
+		explicit Semaphore(const Uint32 initialCount = 0u);
+
+		Semaphore(const Semaphore& semaphore) = delete;
+		Semaphore(Semaphore&& semaphore) = delete;
+
+		~Semaphore() = default;
+
+		/**
+		 * Decrements the count, blocking the calling thread while it is zero.
+		 */
+		void acquire();
+
+		/**
+		 * Gets the number of times a thread had to wait for the semaphore.
+		 */
+		inline Uint32 contentionCount() const;
+
+		inline Uint32 count() const;
+
+		void release(const Uint32 count = 1u);
+
+		inline void resetContentionCount();
+
+		Bool tryAcquire();
+
+		Semaphore& operator =(const Semaphore& semaphore) = delete;
+		Semaphore& operator =(Semaphore&& semaphore) = delete;
+
+	private:
+
+		std::atomic<Uint32> _count;
+		std::atomic<Uint32> _waiterCount;
+		ContentionCounter _contentionCounter;
+	};
+
+#include "inline/Semaphore.inl"
+}
@@ -0,0 +1,154 @@
+/**
+ * @file core/SmallVector.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <core/InitialiserList.h>
+#include <core/Types.h>
+#include <core/debug/Assert.h>
+#include <core/memory/STDAllocator.h>
+
+namespace Core
+{
+	/**
+	 * Dynamic-size array, which stores up to InlineCapacity elements inside
+	 * the object itself and allocates only when it grows beyond that. Suited
+	 * for short-lived arrays that are usually small.
+	 *
+	 * Growing invalidates pointers, references and iterators. Moving a small
+	 * vector moves its elements one by one while they are stored inline.
+	 */
+	template<typename T, Uint InlineCapacity, typename Allocator = Memory::STDAllocator<T>>
+	class SmallVector final
+	{
+	public:
+
+		static_assert(InlineCapacity > 0u, "Inline capacity must be greater than zero");
+
+		using allocator_type  = Allocator;
+		using const_iterator  = const T*;
+		using const_pointer	  = const T*;
+		using const_reference = const T&;
+		using difference_type = Int;
+		using iterator		  = T*;
+		using pointer		  = T*;
+		using reference		  = T&;
+		using size_type		  = Uint;
+		using value_type	  = T;
+
+		explicit SmallVector(const Allocator& allocator = Allocator());
+
+		explicit SmallVector(const Uint size, const Allocator& allocator = Allocator());
+
+		SmallVector(const Uint size, const T& value, const Allocator& allocator = Allocator());
+
+		SmallVector(InitialiserList<T> values, const Allocator& allocator = Allocator());
+
+		SmallVector(const SmallVector& smallVector);
+
+		SmallVector(SmallVector&& smallVector);
+
+		~SmallVector();
+
+		inline T& back();
+
+		inline const T& back() const;
+
+		inline iterator begin();
+
+		inline const_iterator begin() const;
+
+		inline Uint capacity() const;
+
+		inline const_iterator cbegin() const;
+
+		inline const_iterator cend() const;
+
+		void clear();
+
+		inline T* data();
+
+		inline const T* data() const;
+
+		template<typename... Parameters>
+		T& emplace_back(Parameters&&... parameters);
+
+		inline Bool empty() const;
+
+		inline iterator end();
+
+		inline const_iterator end() const;
+
+		inline T& front();
+
+		inline const T& front() const;
+
+		/**
+		 * Checks if the elements are stored inside the object.
+		 */
+		inline Bool isInline() const;
+
+		void pop_back();
+
+		inline void push_back(const T& value);
+
+		inline void push_back(T&& value);
+
+		void reserve(const Uint capacity);
+
+		void resize(const Uint size);
+
+		inline Uint size() const;
+
+		SmallVector& operator =(const SmallVector& smallVector);
+
+		SmallVector& operator =(SmallVector&& smallVector);
+
+		inline T& operator [](const Uint index);
+
+		inline const T& operator [](const Uint index) const;
+
+	private:
+
+		using InlineStorage = typename std::aligned_storage<sizeof(T) * InlineCapacity, alignof(T)>::type;
+
+		InlineStorage _inlineStorage;
+		T* _data;
+		Uint _size;
+		Uint _capacity;
+		Allocator _allocator;
+
+		void deallocate();
+
+		void grow(const Uint minimumCapacity);
+
+		inline Uint grownCapacity(const Uint minimumCapacity) const;
+
+		inline T* inlineData();
+
+		void relocate(T* data, const Uint capacity);
+	};
+
+#include "inline/SmallVector.inl"
+}
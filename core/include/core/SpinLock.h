@@ -0,0 +1,72 @@
+/**
+ * @file core/SpinLock.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <core/ContentionCounter.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Adaptive spinlock. A contended lock spins for a number of iterations
+	 * based on how long the previous acquisitions took, after which the
+	 * thread yields between attempts. Intended for very short critical
+	 * sections.
+	 */
+	class SpinLock final
+	{
+	public:
+
+		SpinLock();
+
+		SpinLock(const SpinLock& spinLock) = delete;
+		SpinLock(SpinLock&& spinLock) = delete;
+
+		~SpinLock() = default;
+
+		/**
+		 * Gets the number of times a thread had to wait for the lock.
+		 */
+		inline Uint32 contentionCount() const;
+
+		inline void lock();
+
+		inline void resetContentionCount();
+
+		inline Bool tryLock();
+
+		inline void unlock();
+
+		SpinLock& operator =(const SpinLock& spinLock) = delete;
+		SpinLock& operator =(SpinLock&& spinLock) = delete;
+
+	private:
+
+		std::atomic<Bool> _isLocked;
+		std::atomic<Uint32> _spinCount;
+		ContentionCounter _contentionCounter;
+
+		void lockContended();
+	};
+
+#include "inline/SpinLock.inl"
+}
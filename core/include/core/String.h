@@ -22,6 +22,7 @@
 
 #include <functional>
 #include <string>
+#include <core/Hash.h>
 #include <core/Types.h>
 #include <core/memory/STDAllocator.h>
 
@@ -71,10 +72,7 @@ namespace std
 	{
 		Uint operator ()(const Core::String8& value) const
 		{
-			using StandardString = basic_string<Char8>;
-			hash<StandardString> hasher;
-
-			return hasher(StandardString(value.begin(), value.end()));
+			return static_cast<Uint>(Core::hashBytes(value.data(), value.size() * sizeof(Char8)));
 		}
 	};
 
@@ -83,10 +81,7 @@ namespace std
 	{
 		Uint operator ()(const Core::String16& value) const
 		{
-			using StandardString = basic_string<Char16>;
-			hash<StandardString> hasher;
-
-			return hasher(StandardString(value.begin(), value.end()));
+			return static_cast<Uint>(Core::hashBytes(value.data(), value.size() * sizeof(Char16)));
 		}
 	};
 }
@@ -0,0 +1,102 @@
+/**
+ * @file core/StringView.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <core/Hash.h>
+#include <core/String.h>
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Non-owning view of a character array. The viewed characters must
+	 * outlive the view and need not be null-terminated.
+	 */
+	template<typename T>
+	class StringViewTemplate final
+	{
+	public:
+
+		inline StringViewTemplate();
+
+		inline StringViewTemplate(const T* data, const Uint size);
+
+		inline StringViewTemplate(const T* string);
+
+		template<typename Allocator>
+		inline StringViewTemplate(const StringTemplate<T, Allocator>& string);
+
+		StringViewTemplate(const StringViewTemplate& stringView) = default;
+		StringViewTemplate(StringViewTemplate&& stringView) = default;
+
+		~StringViewTemplate() = default;
+
+		inline const T* begin() const;
+
+		inline const T* data() const;
+
+		inline Bool empty() const;
+
+		inline const T* end() const;
+
+		inline Uint size() const;
+
+		StringViewTemplate& operator =(const StringViewTemplate& stringView) = default;
+		StringViewTemplate& operator =(StringViewTemplate&& stringView) = default;
+
+		inline Bool operator ==(const StringViewTemplate& stringView) const;
+
+		inline Bool operator !=(const StringViewTemplate& stringView) const;
+
+		inline const T& operator [](const Uint index) const;
+
+	private:
+
+		const T* _data;
+		Uint _size;
+	};
+
+	/**
+	 * View of a Char8 character array
+	 */
+	using StringView8 = StringViewTemplate<Char8>;
+
+	/**
+	 * View of a Char16 character array
+	 */
+	using StringView16 = StringViewTemplate<Char16>;
+
+#include "inline/StringView.inl"
+}
+
+namespace std
+{
+	template<typename T>
+	struct hash<Core::StringViewTemplate<T>>
+	{
+		Uint operator ()(const Core::StringViewTemplate<T>& value) const
+		{
+			return static_cast<Uint>(Core::hashBytes(value.data(), value.size() * sizeof(T)));
+		}
+	};
+}
@@ -24,6 +24,54 @@
 
 namespace Core
 {
+	enum class ThreadPriority
+	{
+		Lowest,
+		Low,
+		Normal,
+		High,
+		Highest
+	};
+
+	struct ThreadOptions final
+	{
+		/**
+		 * The maximum length of a thread name, excluding the terminator.
+		 * Longer names are truncated.
+		 */
+		static const Uint32 MAX_NAME_LENGTH = 15u;
+
+		/**
+		 * A set bit n allows the thread to run on the logical processor n. If
+		 * zero, the thread can run on any processor.
+		 */
+		Uint64 affinityMask;
+
+		/**
+		 * The name shown in debuggers and profilers, or nullptr. The string is
+		 * copied.
+		 */
+		const Char8* name;
+
+		/**
+		 * Raising the priority above normal may require privileges. If the
+		 * priority cannot be set, a warning is logged and the thread runs with
+		 * the normal priority.
+		 */
+		ThreadPriority priority;
+
+		/**
+		 * The stack size in bytes. If zero, the platform default is used.
+		 */
+		Uint32 stackSize;
+
+		ThreadOptions()
+			: affinityMask(0u),
+			  name(nullptr),
+			  priority(ThreadPriority::Normal),
+			  stackSize(0u) { }
+	};
+
 	class Thread final
 	{
 	public:
@@ -47,11 +95,25 @@ namespace Core
 
 		void run(ThreadEntryFunction entryFunction, Void* parameter, const Bool isJoinable = true) const;
 
+		void run(ThreadEntryFunction entryFunction, Void* parameter, const ThreadOptions& options,
+			const Bool isJoinable = true) const;
+
 		Thread& operator =(const Thread& thread) = delete;
 		Thread& operator =(Thread&& thread) = delete;
 
 		static Uint32 currentID();
 
+		/**
+		 * Gets the number of logical processors available.
+		 */
+		static Uint32 hardwareConcurrency();
+
+		/**
+		 * Gives the rest of the time slice of the calling thread to other
+		 * threads.
+		 */
+		static void yield();
+
 	private:
 
 		class Implementation;
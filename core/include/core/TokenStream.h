@@ -0,0 +1,134 @@
+/**
+ * @file core/TokenStream.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <iterator>
+#include <core/StringView.h>
+#include <core/Tokeniser.h>
+#include <core/Types.h>
+#include <core/Vector.h>
+
+namespace Core
+{
+	class FileStream;
+
+	/**
+	 * Tokenises its input incrementally, yielding one token at a time with the
+	 * classification of a Tokeniser. The input is either a file stream, which
+	 * is read in chunks into a buffer that grows only to fit the longest
+	 * token, or a region of memory, which is tokenised in place.
+	 *
+	 * A yielded lexeme is valid until the next token is requested.
+	 */
+	class TokenStream final
+	{
+	public:
+
+		class Iterator final
+		{
+		public:
+
+			using difference_type	= Int;
+			using iterator_category = std::input_iterator_tag;
+			using pointer			= const TokenView*;
+			using reference			= const TokenView&;
+			using value_type		= TokenView;
+
+			inline Iterator();
+
+			inline explicit Iterator(TokenStream* tokenStream);
+
+			Iterator(const Iterator& iterator) = default;
+			Iterator(Iterator&& iterator) = default;
+
+			~Iterator() = default;
+
+			Iterator& operator =(const Iterator& iterator) = default;
+			Iterator& operator =(Iterator&& iterator) = default;
+
+			inline const TokenView& operator *() const;
+
+			inline const TokenView* operator ->() const;
+
+			inline Iterator& operator ++();
+
+			inline Bool operator ==(const Iterator& iterator) const;
+
+			inline Bool operator !=(const Iterator& iterator) const;
+
+		private:
+
+			TokenStream* _tokenStream;
+			TokenView _token;
+		};
+
+		static const Uint32 DEFAULT_BUFFER_SIZE = 16384u;
+
+		/**
+		 * Tokenises an open file stream from its current position.
+		 */
+		TokenStream(const Tokeniser& tokeniser, FileStream& fileStream,
+			const Uint32 bufferSize = DEFAULT_BUFFER_SIZE);
+
+		/**
+		 * Tokenises a region of memory, e.g. a string or a mapped file. The
+		 * region must outlive the use of the yielded lexemes.
+		 */
+		TokenStream(const Tokeniser& tokeniser, const StringView8& source);
+
+		TokenStream(const TokenStream& tokenStream) = delete;
+		TokenStream(TokenStream&& tokenStream) = delete;
+
+		~TokenStream() = default;
+
+		/**
+		 * Gets an iterator to the next token. The iterator is single-pass, and
+		 * advancing it consumes the token stream.
+		 */
+		inline Iterator begin();
+
+		inline Iterator end();
+
+		/**
+		 * Gets the next token.
+		 *
+		 * @return
+		 *   False if the end of the input was reached, true otherwise
+		 */
+		Bool next(TokenView& token);
+
+		TokenStream& operator =(const TokenStream& tokenStream) = delete;
+		TokenStream& operator =(TokenStream&& tokenStream) = delete;
+
+	private:
+
+		const Tokeniser& _tokeniser;
+		FileStream* _fileStream;
+		Vector<Char8> _buffer;
+		const Char8* _data;
+		Uint _position;
+		Uint _size;
+
+		Bool refill(const Uint keepPosition);
+	};
+
+#include "inline/TokenStream.inl"
+}
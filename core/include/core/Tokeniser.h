@@ -20,12 +20,18 @@
 
 #pragma once
 
+#include <core/Array.h>
 #include <core/String.h>
+#include <core/StringView.h>
 #include <core/Types.h>
 #include <core/Vector.h>
 
 namespace Core
 {
+	/**
+	 * Token referring to a lexeme in the token stream by its offset and
+	 * length. Use Tokeniser::lexeme() to view the lexeme.
+	 */
 	struct Token final
 	{
 		enum class Type
@@ -34,12 +40,30 @@ namespace Core
 			Unknown
 		};
 
-		String8 lexeme;
+		Uint32 offset;
+		Uint32 length;
 		Type type;
 	};
 
 	using TokenList = Vector<Token>;
 
+	/**
+	 * Token viewing its lexeme directly
+	 */
+	struct TokenView final
+	{
+		StringView8 lexeme;
+		Token::Type type;
+	};
+
+	/**
+	 * Splits a token stream into delimiter tokens and the tokens between them.
+	 * Whitespace characters separate tokens but are not tokens themselves.
+	 * Carriage returns are always whitespace.
+	 *
+	 * The tokens are stored in a list reused between calls, and they refer to
+	 * the token stream instead of copying it.
+	 */
 	class Tokeniser final
 	{
 	public:
@@ -52,21 +76,39 @@ namespace Core
 
 		~Tokeniser() = default;
 
-		const TokenList& tokenise(const String8& tokenStream);
+		/**
+		 * Gets the lexeme of a token from the latest token stream.
+		 */
+		inline StringView8 lexeme(const Token& token) const;
+
+		/**
+		 * Tokenises the token stream. The stream must outlive the use of the
+		 * returned tokens, which are valid until the next call.
+		 */
+		const TokenList& tokenise(const StringView8& tokenStream);
 
 		Tokeniser& operator =(const Tokeniser& tokeniser) = delete;
 		Tokeniser& operator =(Tokeniser&& tokeniser) = delete;
 
 	private:
 
-		String8 _delimiterCharacters;
-		String8 _whitespaceCharacters;
+		friend class TokenStream;
+
+		enum class CharacterClass : Uint8
+		{
+			Other,
+			Delimiter,
+			Whitespace
+		};
+
+		Array<CharacterClass, 256u> _characterClasses;
 		TokenList _tokens;
-		const String8* _tokenStream;
+		StringView8 _tokenStream;
 
-		Bool isWhitespaceCharacter(const Uint streamPosition) const;
-		Bool isDelimiterCharacter(const Uint streamPosition) const;
 		void addToken(const Token::Type& type, const Uint streamPosition, const Uint lexemeLength);
-		Uint findNextDelimiterPosition(const Uint streamPosition) const;
+
+		inline CharacterClass classify(const Char8 character) const;
 	};
+
+#include "inline/Tokeniser.inl"
 }
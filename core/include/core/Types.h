@@ -80,6 +80,11 @@ using Char8 = char;
  */
 using Char16 = char16_t;
 
+/**
+ * 32-bit unicode character (UTF-32)
+ */
+using Char32 = char32_t;
+
 /**
  * Boolean
  */
@@ -0,0 +1,72 @@
+/**
+ * @file core/Unicode.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+
+namespace Core
+{
+	/**
+	 * Transcoding between UTF-8, UTF-16 and UTF-32.
+	 *
+	 * The input is validated: overlong encodings, surrogate code points,
+	 * unpaired surrogates and code points above U+10FFFF are rejected. The
+	 * lengths are in code units and exclude any null terminator, which is
+	 * neither read nor written.
+	 *
+	 * The *Length() functions compute the length of the output in advance, so
+	 * that the caller can size its buffer. The transcoding functions write
+	 * into the caller's buffer. Both return INVALID_LENGTH if the input is
+	 * invalid, and the transcoding functions also if the output does not fit
+	 * in the buffer.
+	 *
+	 * Runs of ASCII characters are converted 16 at a time with SSE2 between
+	 * UTF-8 and UTF-16.
+	 */
+	namespace Unicode
+	{
+		constexpr Uint INVALID_LENGTH = ~static_cast<Uint>(0u);
+
+		Uint toUtf8(const Char16* string, const Uint length, Char8* output, const Uint outputSize);
+
+		Uint toUtf8(const Char32* string, const Uint length, Char8* output, const Uint outputSize);
+
+		Uint toUtf8Length(const Char16* string, const Uint length);
+
+		Uint toUtf8Length(const Char32* string, const Uint length);
+
+		Uint toUtf16(const Char8* string, const Uint length, Char16* output, const Uint outputSize);
+
+		Uint toUtf16(const Char32* string, const Uint length, Char16* output, const Uint outputSize);
+
+		Uint toUtf16Length(const Char8* string, const Uint length);
+
+		Uint toUtf16Length(const Char32* string, const Uint length);
+
+		Uint toUtf32(const Char8* string, const Uint length, Char32* output, const Uint outputSize);
+
+		Uint toUtf32(const Char16* string, const Uint length, Char32* output, const Uint outputSize);
+
+		Uint toUtf32Length(const Char8* string, const Uint length);
+
+		Uint toUtf32Length(const Char16* string, const Uint length);
+	}
+}
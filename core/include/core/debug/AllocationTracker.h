@@ -27,12 +27,17 @@
 #include <functional>
 #include <memory>
 #include <utility>
-#include <core/Map.h>
+#include <core/FlatMap.h>
+#include <core/Mutex.h>
 #include <core/Singleton.h>
 #include <core/Types.h>
 
 namespace Debug
 {
+	/**
+	 * Records the live allocations to report leaks on deinitialisation.
+	 * Allocations may be registered and deregistered from any thread.
+	 */
 	class AllocationTracker final : public Core::Singleton<AllocationTracker>
 	{
 	public:
@@ -74,10 +79,11 @@ namespace Debug
 		};
 
 		using AllocationRecordMap =
-			Core::Map<Void*, AllocationRecord, std::hash<Void*>, std::equal_to<Void*>,
+			Core::FlatMap<Void*, AllocationRecord, std::hash<Void*>, std::equal_to<Void*>,
 				std::allocator<std::pair<Void* const, AllocationRecord>>>;
 
 		AllocationRecordMap _allocationRecords;
+		Core::Mutex _mutex;
 		Bool _isInitialised;
 
 		void checkForMemoryLeaks() const;
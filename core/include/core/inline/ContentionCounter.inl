@@ -0,0 +1,50 @@
+/**
+ * @file core/inline/ContentionCounter.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+ContentionCounter::ContentionCounter()
+#if defined(DE_INTERNAL_CONFIG_TRACK_CONTENTION)
+	: _value(0u)
+#endif
+{ }
+
+void ContentionCounter::increment()
+{
+#if defined(DE_INTERNAL_CONFIG_TRACK_CONTENTION)
+	_value.fetch_add(1u, std::memory_order_relaxed);
+#endif
+}
+
+void ContentionCounter::reset()
+{
+#if defined(DE_INTERNAL_CONFIG_TRACK_CONTENTION)
+	_value.store(0u, std::memory_order_relaxed);
+#endif
+}
+
+Uint32 ContentionCounter::value() const
+{
+#if defined(DE_INTERNAL_CONFIG_TRACK_CONTENTION)
+	return _value.load(std::memory_order_relaxed);
+#else
+	return 0u;
+#endif
+}
@@ -0,0 +1,662 @@
+/**
+ * @file core/inline/FlatHashTable.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// FlatHashTableGroup
+
+// Public
+
+FlatHashTableGroup::FlatHashTableGroup(const Int8* control)
+	: _control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) { }
+
+Uint32 FlatHashTableGroup::match(const Int8 hashFragment) const
+{
+	return static_cast<Uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hashFragment), _control)));
+}
+
+Uint32 FlatHashTableGroup::matchEmpty() const
+{
+	return static_cast<Uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(CONTROL_EMPTY), _control)));
+}
+
+Uint32 FlatHashTableGroup::matchEmptyOrDeleted() const
+{
+	// Full slots have non-negative control bytes, and both of the special
+	// values are below -1
+
+	return static_cast<Uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), _control)));
+}
+
+// Static
+
+Uint32 FlatHashTableGroup::countTrailingZeros(const Uint32 mask)
+{
+#if DE_COMPILER == DE_COMPILER_MSVC
+	unsigned long index;
+	_BitScanForward(&index, mask);
+
+	return index;
+#else
+	return static_cast<Uint32>(__builtin_ctz(mask));
+#endif
+}
+
+
+// FlatHashTable::IteratorTemplate
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+template<typename IteratorValue>
+class FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::IteratorTemplate final
+{
+public:
+
+	using difference_type	= Int;
+	using iterator_category = std::forward_iterator_tag;
+	using pointer			= IteratorValue*;
+	using reference			= IteratorValue&;
+	using value_type		= Value;
+
+	IteratorTemplate()
+		: _control(nullptr),
+		  _controlEnd(nullptr),
+		  _slot(nullptr) { }
+
+	IteratorTemplate(const Int8* control, const Int8* controlEnd, IteratorValue* slot)
+		: _control(control),
+		  _controlEnd(controlEnd),
+		  _slot(slot) { }
+
+	IteratorTemplate(const IteratorTemplate& iterator) = default;
+
+	template<typename OtherValue>
+	IteratorTemplate(const IteratorTemplate<OtherValue>& iterator)
+		: _control(iterator._control),
+		  _controlEnd(iterator._controlEnd),
+		  _slot(iterator._slot) { }
+
+	~IteratorTemplate() = default;
+
+	IteratorTemplate& operator =(const IteratorTemplate& iterator) = default;
+
+	IteratorValue& operator *() const
+	{
+		return *_slot;
+	}
+
+	IteratorValue* operator ->() const
+	{
+		return _slot;
+	}
+
+	IteratorTemplate& operator ++()
+	{
+		++_control;
+		++_slot;
+		skipEmptySlots();
+
+		return *this;
+	}
+
+	IteratorTemplate operator ++(int)
+	{
+		IteratorTemplate iterator = *this;
+		++*this;
+
+		return iterator;
+	}
+
+	template<typename OtherValue>
+	Bool operator ==(const IteratorTemplate<OtherValue>& iterator) const
+	{
+		return _slot == iterator._slot;
+	}
+
+	template<typename OtherValue>
+	Bool operator !=(const IteratorTemplate<OtherValue>& iterator) const
+	{
+		return _slot != iterator._slot;
+	}
+
+private:
+
+	template<typename OtherValue>
+	friend class IteratorTemplate;
+
+	friend class FlatHashTable;
+
+	const Int8* _control;
+	const Int8* _controlEnd;
+	IteratorValue* _slot;
+
+	void skipEmptySlots()
+	{
+		while(_control != _controlEnd && *_control < 0)
+		{
+			++_control;
+			++_slot;
+		}
+	}
+};
+
+
+// FlatHashTable
+
+// Public
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::FlatHashTable(const Uint capacity,
+	const Hash& hash, const KeyEqual& keyEqual, const Allocator& allocator)
+	: _control(nullptr),
+	  _slots(nullptr),
+	  _capacity(0u),
+	  _size(0u),
+	  _growthLeft(0u),
+	  _hash(hash),
+	  _keyEqual(keyEqual),
+	  _allocator(allocator)
+{
+	reserve(capacity);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::FlatHashTable(const FlatHashTable& table)
+	: _control(nullptr),
+	  _slots(nullptr),
+	  _capacity(0u),
+	  _size(0u),
+	  _growthLeft(0u),
+	  _hash(table._hash),
+	  _keyEqual(table._keyEqual),
+	  _allocator(table._allocator)
+{
+	reserve(table._size);
+
+	for(const_iterator i = table.begin(), end = table.end(); i != end; ++i)
+		emplaceUnique(KeyExtractor::key(*i), *i);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::FlatHashTable(FlatHashTable&& table)
+	: _control(table._control),
+	  _slots(table._slots),
+	  _capacity(table._capacity),
+	  _size(table._size),
+	  _growthLeft(table._growthLeft),
+	  _hash(std::move(table._hash)),
+	  _keyEqual(std::move(table._keyEqual)),
+	  _allocator(std::move(table._allocator))
+{
+	table._control = nullptr;
+	table._slots = nullptr;
+	table._capacity = 0u;
+	table._size = 0u;
+	table._growthLeft = 0u;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::~FlatHashTable()
+{
+	destroyValues();
+	deallocate();
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::begin()
+{
+	iterator iterator(_control, _control + _capacity, _slots);
+	iterator.skipEmptySlots();
+
+	return iterator;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::const_iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::begin() const
+{
+	const_iterator iterator(_control, _control + _capacity, _slots);
+	iterator.skipEmptySlots();
+
+	return iterator;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::capacity() const
+{
+	return _capacity;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::const_iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::cbegin() const
+{
+	return begin();
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::const_iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::cend() const
+{
+	return end();
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+void FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::clear()
+{
+	destroyValues();
+
+	for(Uint i = 0u; i < _capacity; ++i)
+		_control[i] = FlatHashTableGroup::CONTROL_EMPTY;
+
+	_size = 0u;
+	_growthLeft = maxSize(_capacity);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::count(const Key& key) const
+{
+	return find(key) == end() ? 0u : 1u;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Bool FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::empty() const
+{
+	return _size == 0u;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::end()
+{
+	return iterator(_control + _capacity, _control + _capacity, _slots + _capacity);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::const_iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::end() const
+{
+	return const_iterator(_control + _capacity, _control + _capacity, _slots + _capacity);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::erase(const_iterator position)
+{
+	const Uint index = static_cast<Uint>(position._slot - _slots);
+	DE_ASSERT(index < _capacity && _control[index] >= 0);
+	_slots[index].~Value();
+	--_size;
+
+	// A slot can be marked empty only if its group already has an empty slot,
+	// as otherwise a probe for a key in a later group would stop here
+
+	const Uint groupIndex = index & ~static_cast<Uint>(FlatHashTableGroup::SIZE - 1u);
+
+	if(FlatHashTableGroup(_control + groupIndex).matchEmpty() != 0u)
+	{
+		setControl(index, FlatHashTableGroup::CONTROL_EMPTY);
+		++_growthLeft;
+	}
+	else
+	{
+		setControl(index, FlatHashTableGroup::CONTROL_DELETED);
+	}
+
+	iterator iterator(_control + index, _control + _capacity, _slots + index);
+	++iterator;
+
+	return iterator;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::erase(const Key& key)
+{
+	const const_iterator iterator = find(key);
+
+	if(iterator == end())
+		return 0u;
+
+	erase(iterator);
+	return 1u;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::find(const Key& key)
+{
+	const Uint index = findIndex(key, hashKey(key));
+	return iterator(_control + index, _control + _capacity, _slots + index);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::const_iterator
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::find(const Key& key) const
+{
+	const Uint index = findIndex(key, hashKey(key));
+	return const_iterator(_control + index, _control + _capacity, _slots + index);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Float32 FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::load_factor() const
+{
+	return _capacity == 0u ? 0.0f : static_cast<Float32>(_size) / static_cast<Float32>(_capacity);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+void FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::reserve(const Uint count)
+{
+	if(count <= maxSize(_capacity))
+		return;
+
+	Uint capacity = FlatHashTableGroup::SIZE;
+
+	while(maxSize(capacity) < count)
+		capacity *= 2u;
+
+	rehash(capacity);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::size() const
+{
+	return _size;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>&
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::operator =(const FlatHashTable& table)
+{
+	if(this != &table)
+	{
+		clear();
+		_hash = table._hash;
+		_keyEqual = table._keyEqual;
+		reserve(table._size);
+
+		for(const_iterator i = table.begin(), end = table.end(); i != end; ++i)
+			emplaceUnique(KeyExtractor::key(*i), *i);
+	}
+
+	return *this;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>&
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::operator =(FlatHashTable&& table)
+{
+	if(this != &table)
+	{
+		destroyValues();
+		deallocate();
+		_control = table._control;
+		_slots = table._slots;
+		_capacity = table._capacity;
+		_size = table._size;
+		_growthLeft = table._growthLeft;
+		_hash = std::move(table._hash);
+		_keyEqual = std::move(table._keyEqual);
+		_allocator = std::move(table._allocator);
+		table._control = nullptr;
+		table._slots = nullptr;
+		table._capacity = 0u;
+		table._size = 0u;
+		table._growthLeft = 0u;
+	}
+
+	return *this;
+}
+
+// Protected
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+template<typename... Parameters>
+std::pair<typename FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::iterator, Bool>
+	FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::emplaceUnique(const Key& key,
+		Parameters&&... parameters)
+{
+	const Uint hash = hashKey(key);
+	Uint index = findIndex(key, hash);
+
+	if(index != _capacity)
+		return std::make_pair(iterator(_control + index, _control + _capacity, _slots + index), false);
+
+	if(_growthLeft == 0u)
+	{
+		// Drop the deleted slots instead of growing if they take up much of
+		// the table
+
+		if(_capacity == 0u)
+			rehash(FlatHashTableGroup::SIZE);
+		else if(_size < maxSize(_capacity) / 2u)
+			rehash(_capacity);
+		else
+			rehash(2u * _capacity);
+	}
+
+	index = findInsertIndex(hash);
+
+	if(_control[index] == FlatHashTableGroup::CONTROL_EMPTY)
+		--_growthLeft;
+
+	::new (toVoidPointer(_slots + index)) Value(std::forward<Parameters>(parameters)...);
+	setControl(index, static_cast<Int8>(hash & 0x7Fu));
+	++_size;
+
+	return std::make_pair(iterator(_control + index, _control + _capacity, _slots + index), true);
+}
+
+// Private
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Void* FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::allocate(const Uint capacity)
+{
+	return std::allocator_traits<ByteAllocator>::allocate(_allocator, allocationSize(capacity));
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+void FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::deallocate()
+{
+	if(_control != nullptr)
+	{
+		std::allocator_traits<ByteAllocator>::deallocate(_allocator, reinterpret_cast<Uint8*>(_control),
+			allocationSize(_capacity));
+	}
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+void FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::destroyValues()
+{
+	for(Uint i = 0u; i < _capacity; ++i)
+	{
+		if(_control[i] >= 0)
+			_slots[i].~Value();
+	}
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::findIndex(const Key& key,
+	const Uint hash) const
+{
+	if(_capacity == 0u)
+		return 0u;
+
+	const Uint groupMask = _capacity / FlatHashTableGroup::SIZE - 1u;
+	const Int8 hashFragment = static_cast<Int8>(hash & 0x7Fu);
+	Uint groupIndex = (hash >> 7u) & groupMask;
+
+	for(Uint probeCount = 1u; ; ++probeCount)
+	{
+		const Uint groupOffset = groupIndex * FlatHashTableGroup::SIZE;
+		const FlatHashTableGroup group(_control + groupOffset);
+
+		for(Uint32 mask = group.match(hashFragment); mask != 0u; mask &= mask - 1u)
+		{
+			const Uint index = groupOffset + FlatHashTableGroup::countTrailingZeros(mask);
+
+			if(_keyEqual(KeyExtractor::key(_slots[index]), key))
+				return index;
+		}
+
+		if(group.matchEmpty() != 0u || probeCount > groupMask)
+			return _capacity;
+
+		groupIndex = (groupIndex + probeCount) & groupMask;
+	}
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::findInsertIndex(const Uint hash) const
+{
+	const Uint groupMask = _capacity / FlatHashTableGroup::SIZE - 1u;
+	Uint groupIndex = (hash >> 7u) & groupMask;
+
+	for(Uint probeCount = 1u; ; ++probeCount)
+	{
+		const Uint groupOffset = groupIndex * FlatHashTableGroup::SIZE;
+		const Uint32 mask = FlatHashTableGroup(_control + groupOffset).matchEmptyOrDeleted();
+
+		if(mask != 0u)
+			return groupOffset + FlatHashTableGroup::countTrailingZeros(mask);
+
+		groupIndex = (groupIndex + probeCount) & groupMask;
+	}
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::hashKey(const Key& key) const
+{
+	// Many standard hashes are the identity function, so the bits are mixed
+	// to spread them over both the group index and the hash fragment
+
+	Uint64 hash = static_cast<Uint64>(_hash(key)) * 0x9E3779B97F4A7C15ull;
+	hash ^= hash >> 32u;
+
+	return static_cast<Uint>(hash);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+void FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::rehash(const Uint capacity)
+{
+	DE_ASSERT(capacity >= FlatHashTableGroup::SIZE && (capacity & (capacity - 1u)) == 0u);
+	DE_ASSERT(maxSize(capacity) >= _size);
+	Int8* oldControl = _control;
+	Value* oldSlots = _slots;
+	const Uint oldCapacity = _capacity;
+	Uint8* memory = static_cast<Uint8*>(allocate(capacity));
+	_control = reinterpret_cast<Int8*>(memory);
+	_slots = reinterpret_cast<Value*>(memory + slotOffset(capacity));
+	_capacity = capacity;
+	_growthLeft = maxSize(capacity) - _size;
+
+	for(Uint i = 0u; i < capacity; ++i)
+		_control[i] = FlatHashTableGroup::CONTROL_EMPTY;
+
+	for(Uint i = 0u; i < oldCapacity; ++i)
+	{
+		if(oldControl[i] >= 0)
+		{
+			const Uint hash = hashKey(KeyExtractor::key(oldSlots[i]));
+			const Uint index = findInsertIndex(hash);
+			::new (toVoidPointer(_slots + index)) Value(std::move(oldSlots[i]));
+			_control[index] = static_cast<Int8>(hash & 0x7Fu);
+			oldSlots[i].~Value();
+		}
+	}
+
+	if(oldControl != nullptr)
+	{
+		std::allocator_traits<ByteAllocator>::deallocate(_allocator, reinterpret_cast<Uint8*>(oldControl),
+			allocationSize(oldCapacity));
+	}
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+void FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::setControl(const Uint index,
+	const Int8 control)
+{
+	_control[index] = control;
+}
+
+// Static
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::allocationSize(const Uint capacity)
+{
+	return slotOffset(capacity) + capacity * sizeof(Value);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::maxSize(const Uint capacity)
+{
+	// The maximum load factor is 7/8
+
+	return capacity - capacity / 8u;
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Uint FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::slotOffset(const Uint capacity)
+{
+	const Uint alignment = alignof(Value);
+	return (capacity + alignment - 1u) & ~(alignment - 1u);
+}
+
+template<typename Value, typename Key, typename KeyExtractor, typename Hash, typename KeyEqual,
+	typename Allocator>
+Void* FlatHashTable<Value, Key, KeyExtractor, Hash, KeyEqual, Allocator>::toVoidPointer(Value* value)
+{
+	// The values of sets are constant, but are constructed in place
+
+	return static_cast<Void*>(const_cast<typename std::remove_const<Value>::type*>(value));
+}
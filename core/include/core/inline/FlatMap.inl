@@ -0,0 +1,68 @@
+/**
+ * @file core/inline/FlatMap.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// FlatMapKeyExtractor
+
+// Static
+
+template<typename Key, typename T>
+const Key& FlatMapKeyExtractor<Key, T>::key(const std::pair<const Key, T>& value)
+{
+	return value.first;
+}
+
+
+// FlatMap
+
+// Public
+
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+FlatMap<Key, T, Hash, KeyEqual, Allocator>::FlatMap(const Uint capacity, const Hash& hash,
+	const KeyEqual& keyEqual, const Allocator& allocator)
+	: Base(capacity, hash, keyEqual, allocator) { }
+
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template<typename... Parameters>
+std::pair<typename FlatMap<Key, T, Hash, KeyEqual, Allocator>::iterator, Bool>
+	FlatMap<Key, T, Hash, KeyEqual, Allocator>::emplace(const Key& key, Parameters&&... parameters)
+{
+	return Base::emplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+		std::forward_as_tuple(std::forward<Parameters>(parameters)...));
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename FlatMap<Key, T, Hash, KeyEqual, Allocator>::iterator, Bool>
+	FlatMap<Key, T, Hash, KeyEqual, Allocator>::insert(const value_type& value)
+{
+	return Base::emplaceUnique(value.first, value);
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename FlatMap<Key, T, Hash, KeyEqual, Allocator>::iterator, Bool>
+	FlatMap<Key, T, Hash, KeyEqual, Allocator>::insert(value_type&& value)
+{
+	return Base::emplaceUnique(value.first, std::move(value));
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+T& FlatMap<Key, T, Hash, KeyEqual, Allocator>::operator [](const Key& key)
+{
+	return emplace(key).first->second;
+}
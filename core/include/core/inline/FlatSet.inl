@@ -0,0 +1,62 @@
+/**
+ * @file core/inline/FlatSet.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// FlatSetKeyExtractor
+
+// Static
+
+template<typename Key>
+const Key& FlatSetKeyExtractor<Key>::key(const Key& value)
+{
+	return value;
+}
+
+
+// FlatSet
+
+// Public
+
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator>
+FlatSet<Key, Hash, KeyEqual, Allocator>::FlatSet(const Uint capacity, const Hash& hash, const KeyEqual& keyEqual,
+	const Allocator& allocator)
+	: Base(capacity, hash, keyEqual, allocator) { }
+
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator>
+template<typename... Parameters>
+std::pair<typename FlatSet<Key, Hash, KeyEqual, Allocator>::iterator, Bool>
+	FlatSet<Key, Hash, KeyEqual, Allocator>::emplace(Parameters&&... parameters)
+{
+	Key key(std::forward<Parameters>(parameters)...);
+	return Base::emplaceUnique(key, std::move(key));
+}
+
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename FlatSet<Key, Hash, KeyEqual, Allocator>::iterator, Bool>
+	FlatSet<Key, Hash, KeyEqual, Allocator>::insert(const Key& key)
+{
+	return Base::emplaceUnique(key, key);
+}
+
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename FlatSet<Key, Hash, KeyEqual, Allocator>::iterator, Bool>
+	FlatSet<Key, Hash, KeyEqual, Allocator>::insert(Key&& key)
+{
+	return Base::emplaceUnique(key, std::move(key));
+}
@@ -0,0 +1,115 @@
+/**
+ * @file core/inline/MPMCQueue.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+template<typename T, Uint32 Capacity>
+MPMCQueue<T, Capacity>::MPMCQueue()
+	: _enqueuePosition(0u),
+	  _dequeuePosition(0u)
+{
+	for(Uint32 i = 0u; i < Capacity; ++i)
+		_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename T, Uint32 Capacity>
+Uint32 MPMCQueue<T, Capacity>::capacity() const
+{
+	return Capacity;
+}
+
+template<typename T, Uint32 Capacity>
+Bool MPMCQueue<T, Capacity>::tryPop(T& value)
+{
+	Uint32 position = _dequeuePosition.load(std::memory_order_relaxed);
+	Cell* cell;
+
+	for(;;)
+	{
+		cell = &_cells[position & INDEX_MASK];
+		const Uint32 sequence = cell->sequence.load(std::memory_order_acquire);
+		const Int32 difference = static_cast<Int32>(sequence - (position + 1u));
+
+		if(difference == 0)
+		{
+			if(_dequeuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+				break;
+		}
+		else if(difference < 0)
+		{
+			return false;
+		}
+		else
+		{
+			position = _dequeuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	value = std::move(cell->value);
+	cell->sequence.store(position + Capacity, std::memory_order_release);
+	return true;
+}
+
+template<typename T, Uint32 Capacity>
+Bool MPMCQueue<T, Capacity>::tryPush(const T& value)
+{
+	return push(value);
+}
+
+template<typename T, Uint32 Capacity>
+Bool MPMCQueue<T, Capacity>::tryPush(T&& value)
+{
+	return push(std::move(value));
+}
+
+// Private
+
+template<typename T, Uint32 Capacity>
+template<typename U>
+Bool MPMCQueue<T, Capacity>::push(U&& value)
+{
+	Uint32 position = _enqueuePosition.load(std::memory_order_relaxed);
+	Cell* cell;
+
+	for(;;)
+	{
+		cell = &_cells[position & INDEX_MASK];
+		const Uint32 sequence = cell->sequence.load(std::memory_order_acquire);
+		const Int32 difference = static_cast<Int32>(sequence - position);
+
+		if(difference == 0)
+		{
+			if(_enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+				break;
+		}
+		else if(difference < 0)
+		{
+			return false;
+		}
+		else
+		{
+			position = _enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	cell->value = std::forward<U>(value);
+	cell->sequence.store(position + 1u, std::memory_order_release);
+	return true;
+}
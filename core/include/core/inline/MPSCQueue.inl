@@ -0,0 +1,83 @@
+/**
+ * @file core/inline/MPSCQueue.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+template<typename T>
+MPSCQueue<T>::MPSCQueue()
+	: _head(&_stub),
+	  _tail(&_stub) { }
+
+template<typename T>
+T* MPSCQueue<T>::pop()
+{
+	MPSCQueueNode* tail = _tail;
+	MPSCQueueNode* next = tail->_next.load(std::memory_order_acquire);
+
+	if(tail == &_stub)
+	{
+		if(next == nullptr)
+			return nullptr;
+
+		_tail = next;
+		tail = next;
+		next = next->_next.load(std::memory_order_acquire);
+	}
+
+	if(next != nullptr)
+	{
+		_tail = next;
+		return static_cast<T*>(tail);
+	}
+
+	if(tail != _head.load(std::memory_order_acquire))
+		return nullptr;
+
+	// The tail is the last element, so the stub is pushed behind it to keep
+	// the list non-empty after the tail has been popped
+
+	pushNode(&_stub);
+	next = tail->_next.load(std::memory_order_acquire);
+
+	if(next != nullptr)
+	{
+		_tail = next;
+		return static_cast<T*>(tail);
+	}
+
+	return nullptr;
+}
+
+template<typename T>
+void MPSCQueue<T>::push(T* element)
+{
+	DE_ASSERT(element != nullptr);
+	pushNode(element);
+}
+
+// Private
+
+template<typename T>
+void MPSCQueue<T>::pushNode(MPSCQueueNode* node)
+{
+	node->_next.store(nullptr, std::memory_order_relaxed);
+	MPSCQueueNode* previousNode = _head.exchange(node, std::memory_order_acq_rel);
+	previousNode->_next.store(node, std::memory_order_release);
+}
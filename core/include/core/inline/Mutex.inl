@@ -0,0 +1,51 @@
+/**
+ * @file core/inline/Mutex.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+Uint32 Mutex::contentionCount() const
+{
+	return _contentionCounter.value();
+}
+
+void Mutex::lock()
+{
+	Uint32 state = 0u;
+
+	if(!_state.compare_exchange_strong(state, 1u, std::memory_order_acquire, std::memory_order_relaxed))
+		lockContended();
+}
+
+void Mutex::resetContentionCount()
+{
+	_contentionCounter.reset();
+}
+
+Bool Mutex::tryLock()
+{
+	Uint32 state = 0u;
+	return _state.compare_exchange_strong(state, 1u, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void Mutex::unlock()
+{
+	if(_state.fetch_sub(1u, std::memory_order_release) != 1u)
+		unlockContended();
+}
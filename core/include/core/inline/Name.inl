@@ -0,0 +1,57 @@
+/**
+ * @file core/inline/Name.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+Name::Name()
+	: _index(0u) { }
+
+Name::Name(const StringView8& string)
+	: _index(NameTable::instance().intern(string)) { }
+
+Uint32 Name::hash() const
+{
+	return NameTable::instance().hash(_index);
+}
+
+Uint32 Name::index() const
+{
+	return _index;
+}
+
+StringView8 Name::string() const
+{
+	return NameTable::instance().string(_index);
+}
+
+Bool Name::operator ==(const Name& name) const
+{
+	return _index == name._index;
+}
+
+Bool Name::operator !=(const Name& name) const
+{
+	return _index != name._index;
+}
+
+Bool Name::operator <(const Name& name) const
+{
+	return _index < name._index;
+}
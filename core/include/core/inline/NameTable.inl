@@ -0,0 +1,45 @@
+/**
+ * @file core/inline/NameTable.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+Uint32 NameTable::hash(const Uint32 index) const
+{
+	return entry(index).hash;
+}
+
+Uint32 NameTable::size() const
+{
+	return _size.load(std::memory_order_acquire);
+}
+
+StringView8 NameTable::string(const Uint32 index) const
+{
+	const Entry& nameEntry = entry(index);
+	return StringView8(nameEntry.characters, nameEntry.length);
+}
+
+// Private
+
+const NameTable::Entry& NameTable::entry(const Uint32 index) const
+{
+	DE_ASSERT(index < _size.load(std::memory_order_acquire));
+	return _entryBlocks[index / ENTRY_BLOCK_SIZE][index % ENTRY_BLOCK_SIZE];
+}
@@ -0,0 +1,91 @@
+/**
+ * @file core/inline/SPSCQueue.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+template<typename T, Uint32 Capacity>
+SPSCQueue<T, Capacity>::SPSCQueue()
+	: _head(0u),
+	  _cachedTail(0u),
+	  _tail(0u),
+	  _cachedHead(0u) { }
+
+template<typename T, Uint32 Capacity>
+Uint32 SPSCQueue<T, Capacity>::capacity() const
+{
+	return Capacity;
+}
+
+template<typename T, Uint32 Capacity>
+Bool SPSCQueue<T, Capacity>::isEmpty() const
+{
+	return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+}
+
+template<typename T, Uint32 Capacity>
+Bool SPSCQueue<T, Capacity>::tryPop(T& value)
+{
+	const Uint32 head = _head.load(std::memory_order_relaxed);
+
+	if(head == _cachedTail)
+	{
+		_cachedTail = _tail.load(std::memory_order_acquire);
+
+		if(head == _cachedTail)
+			return false;
+	}
+
+	value = std::move(_values[head & INDEX_MASK]);
+	_head.store(head + 1u, std::memory_order_release);
+	return true;
+}
+
+template<typename T, Uint32 Capacity>
+Bool SPSCQueue<T, Capacity>::tryPush(const T& value)
+{
+	return push(value);
+}
+
+template<typename T, Uint32 Capacity>
+Bool SPSCQueue<T, Capacity>::tryPush(T&& value)
+{
+	return push(std::move(value));
+}
+
+// Private
+
+template<typename T, Uint32 Capacity>
+template<typename U>
+Bool SPSCQueue<T, Capacity>::push(U&& value)
+{
+	const Uint32 tail = _tail.load(std::memory_order_relaxed);
+
+	if(tail - _cachedHead == Capacity)
+	{
+		_cachedHead = _head.load(std::memory_order_acquire);
+
+		if(tail - _cachedHead == Capacity)
+			return false;
+	}
+
+	_values[tail & INDEX_MASK] = std::forward<U>(value);
+	_tail.store(tail + 1u, std::memory_order_release);
+	return true;
+}
@@ -0,0 +1,375 @@
+/**
+ * @file core/inline/SmallVector.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>::SmallVector(const Allocator& allocator)
+	: _data(inlineData()),
+	  _size(0u),
+	  _capacity(InlineCapacity),
+	  _allocator(allocator) { }
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>::SmallVector(const Uint size, const Allocator& allocator)
+	: SmallVector(allocator)
+{
+	resize(size);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>::SmallVector(const Uint size, const T& value,
+	const Allocator& allocator)
+	: SmallVector(allocator)
+{
+	reserve(size);
+
+	for(Uint i = 0u; i < size; ++i)
+		::new (static_cast<Void*>(_data + i)) T(value);
+
+	_size = size;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>::SmallVector(InitialiserList<T> values, const Allocator& allocator)
+	: SmallVector(allocator)
+{
+	reserve(static_cast<Uint>(values.size()));
+
+	for(typename InitialiserList<T>::iterator i = values.begin(), end = values.end(); i != end; ++i)
+		::new (static_cast<Void*>(_data + _size++)) T(*i);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>::SmallVector(const SmallVector& smallVector)
+	: SmallVector(smallVector._allocator)
+{
+	reserve(smallVector._size);
+
+	for(Uint i = 0u; i < smallVector._size; ++i)
+		::new (static_cast<Void*>(_data + i)) T(smallVector._data[i]);
+
+	_size = smallVector._size;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>::SmallVector(SmallVector&& smallVector)
+	: SmallVector(smallVector._allocator)
+{
+	*this = std::move(smallVector);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>::~SmallVector()
+{
+	clear();
+	deallocate();
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+T& SmallVector<T, InlineCapacity, Allocator>::back()
+{
+	DE_ASSERT(_size > 0u);
+	return _data[_size - 1u];
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+const T& SmallVector<T, InlineCapacity, Allocator>::back() const
+{
+	DE_ASSERT(_size > 0u);
+	return _data[_size - 1u];
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+typename SmallVector<T, InlineCapacity, Allocator>::iterator SmallVector<T, InlineCapacity, Allocator>::begin()
+{
+	return _data;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+typename SmallVector<T, InlineCapacity, Allocator>::const_iterator
+	SmallVector<T, InlineCapacity, Allocator>::begin() const
+{
+	return _data;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+Uint SmallVector<T, InlineCapacity, Allocator>::capacity() const
+{
+	return _capacity;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+typename SmallVector<T, InlineCapacity, Allocator>::const_iterator
+	SmallVector<T, InlineCapacity, Allocator>::cbegin() const
+{
+	return _data;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+typename SmallVector<T, InlineCapacity, Allocator>::const_iterator
+	SmallVector<T, InlineCapacity, Allocator>::cend() const
+{
+	return _data + _size;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::clear()
+{
+	for(Uint i = 0u; i < _size; ++i)
+		_data[i].~T();
+
+	_size = 0u;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+T* SmallVector<T, InlineCapacity, Allocator>::data()
+{
+	return _data;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+const T* SmallVector<T, InlineCapacity, Allocator>::data() const
+{
+	return _data;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+template<typename... Parameters>
+T& SmallVector<T, InlineCapacity, Allocator>::emplace_back(Parameters&&... parameters)
+{
+	T* value;
+
+	if(_size < _capacity)
+	{
+		value = ::new (static_cast<Void*>(_data + _size)) T(std::forward<Parameters>(parameters)...);
+	}
+	else
+	{
+		// The parameters may refer to an element, so the new element is
+		// constructed before the elements are moved to the new storage
+
+		const Uint capacity = grownCapacity(_size + 1u);
+		T* data = std::allocator_traits<Allocator>::allocate(_allocator, capacity);
+		value = ::new (static_cast<Void*>(data + _size)) T(std::forward<Parameters>(parameters)...);
+		relocate(data, capacity);
+	}
+
+	++_size;
+	return *value;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+Bool SmallVector<T, InlineCapacity, Allocator>::empty() const
+{
+	return _size == 0u;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+typename SmallVector<T, InlineCapacity, Allocator>::iterator SmallVector<T, InlineCapacity, Allocator>::end()
+{
+	return _data + _size;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+typename SmallVector<T, InlineCapacity, Allocator>::const_iterator
+	SmallVector<T, InlineCapacity, Allocator>::end() const
+{
+	return _data + _size;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+T& SmallVector<T, InlineCapacity, Allocator>::front()
+{
+	DE_ASSERT(_size > 0u);
+	return _data[0];
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+const T& SmallVector<T, InlineCapacity, Allocator>::front() const
+{
+	DE_ASSERT(_size > 0u);
+	return _data[0];
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+Bool SmallVector<T, InlineCapacity, Allocator>::isInline() const
+{
+	return _data == reinterpret_cast<const T*>(&_inlineStorage);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::pop_back()
+{
+	DE_ASSERT(_size > 0u);
+	--_size;
+	_data[_size].~T();
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::push_back(const T& value)
+{
+	emplace_back(value);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::push_back(T&& value)
+{
+	emplace_back(std::move(value));
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::reserve(const Uint capacity)
+{
+	if(capacity > _capacity)
+		grow(capacity);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::resize(const Uint size)
+{
+	reserve(size);
+
+	for(Uint i = _size; i < size; ++i)
+		::new (static_cast<Void*>(_data + i)) T();
+
+	for(Uint i = size; i < _size; ++i)
+		_data[i].~T();
+
+	_size = size;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+Uint SmallVector<T, InlineCapacity, Allocator>::size() const
+{
+	return _size;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>& SmallVector<T, InlineCapacity, Allocator>::operator =(
+	const SmallVector& smallVector)
+{
+	if(this != &smallVector)
+	{
+		clear();
+		reserve(smallVector._size);
+
+		for(Uint i = 0u; i < smallVector._size; ++i)
+			::new (static_cast<Void*>(_data + i)) T(smallVector._data[i]);
+
+		_size = smallVector._size;
+	}
+
+	return *this;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+SmallVector<T, InlineCapacity, Allocator>& SmallVector<T, InlineCapacity, Allocator>::operator =(
+	SmallVector&& smallVector)
+{
+	if(this != &smallVector)
+	{
+		clear();
+
+		if(smallVector.isInline())
+		{
+			for(Uint i = 0u; i < smallVector._size; ++i)
+				::new (static_cast<Void*>(_data + i)) T(std::move(smallVector._data[i]));
+
+			_size = smallVector._size;
+			smallVector.clear();
+		}
+		else
+		{
+			// Allocated elements are taken over without moving them
+
+			deallocate();
+			_data = smallVector._data;
+			_size = smallVector._size;
+			_capacity = smallVector._capacity;
+			smallVector._data = smallVector.inlineData();
+			smallVector._size = 0u;
+			smallVector._capacity = InlineCapacity;
+		}
+	}
+
+	return *this;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+T& SmallVector<T, InlineCapacity, Allocator>::operator [](const Uint index)
+{
+	DE_ASSERT(index < _size);
+	return _data[index];
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+const T& SmallVector<T, InlineCapacity, Allocator>::operator [](const Uint index) const
+{
+	DE_ASSERT(index < _size);
+	return _data[index];
+}
+
+// Private
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::deallocate()
+{
+	if(!isInline())
+	{
+		std::allocator_traits<Allocator>::deallocate(_allocator, _data, _capacity);
+		_data = inlineData();
+		_capacity = InlineCapacity;
+	}
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::grow(const Uint minimumCapacity)
+{
+	const Uint capacity = grownCapacity(minimumCapacity);
+	relocate(std::allocator_traits<Allocator>::allocate(_allocator, capacity), capacity);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+Uint SmallVector<T, InlineCapacity, Allocator>::grownCapacity(const Uint minimumCapacity) const
+{
+	const Uint capacity = 2u * _capacity;
+	return capacity < minimumCapacity ? minimumCapacity : capacity;
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+T* SmallVector<T, InlineCapacity, Allocator>::inlineData()
+{
+	return reinterpret_cast<T*>(&_inlineStorage);
+}
+
+template<typename T, Uint InlineCapacity, typename Allocator>
+void SmallVector<T, InlineCapacity, Allocator>::relocate(T* data, const Uint capacity)
+{
+	for(Uint i = 0u; i < _size; ++i)
+	{
+		::new (static_cast<Void*>(data + i)) T(std::move(_data[i]));
+		_data[i].~T();
+	}
+
+	deallocate();
+	_data = data;
+	_capacity = capacity;
+}
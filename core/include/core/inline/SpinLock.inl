@@ -0,0 +1,47 @@
+/**
+ * @file core/inline/SpinLock.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+Uint32 SpinLock::contentionCount() const
+{
+	return _contentionCounter.value();
+}
+
+void SpinLock::lock()
+{
+	if(_isLocked.exchange(true, std::memory_order_acquire))
+		lockContended();
+}
+
+void SpinLock::resetContentionCount()
+{
+	_contentionCounter.reset();
+}
+
+Bool SpinLock::tryLock()
+{
+	return !_isLocked.load(std::memory_order_relaxed) && !_isLocked.exchange(true, std::memory_order_acquire);
+}
+
+void SpinLock::unlock()
+{
+	_isLocked.store(false, std::memory_order_release);
+}
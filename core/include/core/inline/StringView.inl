@@ -0,0 +1,90 @@
+/**
+ * @file core/inline/StringView.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+template<typename T>
+StringViewTemplate<T>::StringViewTemplate()
+	: _data(nullptr),
+	  _size(0u) { }
+
+template<typename T>
+StringViewTemplate<T>::StringViewTemplate(const T* data, const Uint size)
+	: _data(data),
+	  _size(size) { }
+
+template<typename T>
+StringViewTemplate<T>::StringViewTemplate(const T* string)
+	: _data(string),
+	  _size(static_cast<Uint>(std::char_traits<T>::length(string))) { }
+
+template<typename T>
+template<typename Allocator>
+StringViewTemplate<T>::StringViewTemplate(const StringTemplate<T, Allocator>& string)
+	: _data(string.data()),
+	  _size(static_cast<Uint>(string.size())) { }
+
+template<typename T>
+const T* StringViewTemplate<T>::begin() const
+{
+	return _data;
+}
+
+template<typename T>
+const T* StringViewTemplate<T>::data() const
+{
+	return _data;
+}
+
+template<typename T>
+Bool StringViewTemplate<T>::empty() const
+{
+	return _size == 0u;
+}
+
+template<typename T>
+const T* StringViewTemplate<T>::end() const
+{
+	return _data + _size;
+}
+
+template<typename T>
+Uint StringViewTemplate<T>::size() const
+{
+	return _size;
+}
+
+template<typename T>
+Bool StringViewTemplate<T>::operator ==(const StringViewTemplate& stringView) const
+{
+	return _size == stringView._size && std::char_traits<T>::compare(_data, stringView._data, _size) == 0;
+}
+
+template<typename T>
+Bool StringViewTemplate<T>::operator !=(const StringViewTemplate& stringView) const
+{
+	return !(*this == stringView);
+}
+
+template<typename T>
+const T& StringViewTemplate<T>::operator [](const Uint index) const
+{
+	return _data[index];
+}
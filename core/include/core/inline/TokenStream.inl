@@ -0,0 +1,77 @@
+/**
+ * @file core/inline/TokenStream.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// TokenStream::Iterator
+
+// Public
+
+TokenStream::Iterator::Iterator()
+	: _tokenStream(nullptr),
+	  _token() { }
+
+TokenStream::Iterator::Iterator(TokenStream* tokenStream)
+	: _tokenStream(tokenStream),
+	  _token()
+{
+	++*this;
+}
+
+const TokenView& TokenStream::Iterator::operator *() const
+{
+	return _token;
+}
+
+const TokenView* TokenStream::Iterator::operator ->() const
+{
+	return &_token;
+}
+
+TokenStream::Iterator& TokenStream::Iterator::operator ++()
+{
+	if(!_tokenStream->next(_token))
+		_tokenStream = nullptr;
+
+	return *this;
+}
+
+Bool TokenStream::Iterator::operator ==(const Iterator& iterator) const
+{
+	return _tokenStream == iterator._tokenStream;
+}
+
+Bool TokenStream::Iterator::operator !=(const Iterator& iterator) const
+{
+	return _tokenStream != iterator._tokenStream;
+}
+
+
+// TokenStream
+
+// Public
+
+TokenStream::Iterator TokenStream::begin()
+{
+	return Iterator(this);
+}
+
+TokenStream::Iterator TokenStream::end()
+{
+	return Iterator();
+}
@@ -0,0 +1,99 @@
+/**
+ * @file core/maths/BoundingBox.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+#include <core/maths/Vector3.h>
+
+namespace Maths
+{
+	class Ray;
+
+	/**
+	 * Axis-aligned bounding box
+	 */
+	class BoundingBox final
+	{
+	public:
+
+		static const BoundingBox EMPTY;
+
+		Vector3 minimum;
+
+		Vector3 maximum;
+
+		BoundingBox() = default;
+
+		BoundingBox(const Vector3& minimum, const Vector3& maximum);
+
+		BoundingBox(const BoundingBox& boundingBox) = default;
+
+		BoundingBox(BoundingBox&& boundingBox) = default;
+
+		~BoundingBox() = default;
+
+		inline Vector3 centre() const;
+
+		inline Bool contains(const Vector3& point) const;
+
+		inline Vector3 extents() const;
+
+		inline void include(const Vector3& point);
+
+		inline void include(const BoundingBox& boundingBox);
+
+		inline Bool intersects(const BoundingBox& boundingBox) const;
+
+		/**
+		 * Tests whether a ray intersects the box, using the slab method.
+		 *
+		 * @param ray
+		 *   The ray to test
+		 * @param maxDistance
+		 *   The maximum distance along the ray to test for
+		 * @param distance
+		 *   Set to the distance along the ray to the entry point, if the ray
+		 *   intersects the box
+		 * @return
+		 *   True if the ray intersects the box within maxDistance
+		 */
+		Bool intersects(const Ray& ray, const Float32 maxDistance, Float32& distance) const;
+
+		inline Bool isEmpty() const;
+
+		/**
+		 * Gets the surface area of the box. An empty box has zero surface area.
+		 */
+		inline Float32 surfaceArea() const;
+
+		BoundingBox& operator =(const BoundingBox& boundingBox) = default;
+
+		BoundingBox& operator =(BoundingBox&& boundingBox) = default;
+
+		static inline BoundingBox merge(const BoundingBox& boundingBoxA, const BoundingBox& boundingBoxB);
+	};
+
+	inline Bool operator ==(const BoundingBox& boundingBoxA, const BoundingBox& boundingBoxB);
+
+	inline Bool operator !=(const BoundingBox& boundingBoxA, const BoundingBox& boundingBoxB);
+
+#include "inline/BoundingBox.inl"
+}
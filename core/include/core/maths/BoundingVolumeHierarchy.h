@@ -0,0 +1,134 @@
+/**
+ * @file core/maths/BoundingVolumeHierarchy.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+#include <core/Vector.h>
+#include <core/maths/BoundingBox.h>
+
+namespace Maths
+{
+	class Frustum;
+	class Ray;
+
+	/**
+	 * Bounding volume hierarchy over axis-aligned bounding boxes. The tree is
+	 * built with a binned surface area heuristic and stored as a flat node
+	 * array, in which the children of a node always follow their parent.
+	 */
+	class BoundingVolumeHierarchy final
+	{
+	public:
+
+		using ObjectIndexList = Core::Vector<Uint32>;
+
+		BoundingVolumeHierarchy() = default;
+
+		BoundingVolumeHierarchy(const BoundingVolumeHierarchy& boundingVolumeHierarchy) = delete;
+		BoundingVolumeHierarchy(BoundingVolumeHierarchy&& boundingVolumeHierarchy) = delete;
+
+		~BoundingVolumeHierarchy() = default;
+
+		/**
+		 * Builds the hierarchy from scratch. The indices reported by the
+		 * queries refer to the given array.
+		 *
+		 * @param boundingBoxes
+		 *   The bounding boxes of the objects
+		 * @param count
+		 *   The number of bounding boxes
+		 * @param threadCount
+		 *   The number of threads to build the subtrees with
+		 */
+		void build(const BoundingBox* boundingBoxes, const Uint32 count, const Uint32 threadCount = 1u);
+
+		void clear();
+
+		inline Bool isEmpty() const;
+
+		inline Uint32 nodeCount() const;
+
+		inline Uint32 objectCount() const;
+
+		/**
+		 * Appends the indices of the objects intersecting the frustum to
+		 * results.
+		 */
+		void queryFrustum(const Frustum& frustum, ObjectIndexList& results) const;
+
+		/**
+		 * Appends the indices of the objects overlapping the box to results.
+		 */
+		void queryOverlap(const BoundingBox& boundingBox, ObjectIndexList& results) const;
+
+		/**
+		 * Appends the indices of the objects hit by the ray within maxDistance
+		 * to results.
+		 */
+		void queryRay(const Ray& ray, const Float32 maxDistance, ObjectIndexList& results) const;
+
+		/**
+		 * Updates the node bounds after the objects have moved, keeping the
+		 * tree topology. The array must have the same layout as the one the
+		 * hierarchy was built from. The tree quality degrades as the objects
+		 * move away from their original positions, so rebuild it every now
+		 * and then.
+		 */
+		void refit(const BoundingBox* boundingBoxes);
+
+		BoundingVolumeHierarchy& operator =(const BoundingVolumeHierarchy& boundingVolumeHierarchy) = delete;
+		BoundingVolumeHierarchy& operator =(BoundingVolumeHierarchy&& boundingVolumeHierarchy) = delete;
+
+	private:
+
+		class Builder;
+		struct SubtreeTask;
+
+		struct Node
+		{
+			BoundingBox boundingBox;
+
+			/**
+			 * The index of the left child for interior nodes, the right child
+			 * being next to it. The index of the first object for leaves.
+			 */
+			Uint32 offset;
+
+			/**
+			 * Zero for interior nodes.
+			 */
+			Uint32 objectCount;
+		};
+
+		using NodeList = Core::Vector<Node>;
+
+		NodeList _nodes;
+		ObjectIndexList _objectIndices;
+		Core::Vector<BoundingBox> _objectBoundingBoxes;
+
+		template<typename NodeTest, typename ObjectTest>
+		void query(NodeTest nodeTest, ObjectTest objectTest, ObjectIndexList& results) const;
+
+		static Int32 buildSubtree(Void* parameter);
+	};
+
+#include "inline/BoundingVolumeHierarchy.inl"
+}
@@ -0,0 +1,72 @@
+/**
+ * @file core/maths/Frustum.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Array.h>
+#include <core/Types.h>
+#include <core/maths/Vector4.h>
+
+namespace Maths
+{
+	class BoundingBox;
+	class Matrix4;
+
+	class Frustum final
+	{
+	public:
+
+		Frustum() = default;
+
+		/**
+		 * Extracts the clipping planes from a combined view-projection
+		 * transform.
+		 *
+		 * @param viewProjectionTransform
+		 *   A transform which maps world space to OpenGL clip space
+		 */
+		explicit Frustum(const Matrix4& viewProjectionTransform);
+
+		Frustum(const Frustum& frustum) = default;
+
+		Frustum(Frustum&& frustum) = default;
+
+		~Frustum() = default;
+
+		/**
+		 * Tests whether a box is inside or intersects the frustum. The test is
+		 * conservative: some boxes near the frustum corners are reported as
+		 * intersecting although they are outside.
+		 */
+		Bool intersects(const BoundingBox& boundingBox) const;
+
+		Frustum& operator =(const Frustum& frustum) = default;
+
+		Frustum& operator =(Frustum&& frustum) = default;
+
+	private:
+
+		/**
+		 * Each plane is stored as (normal.x, normal.y, normal.z, distance),
+		 * with the normal pointing into the frustum.
+		 */
+		Core::Array<Vector4, 6u> _planes;
+	};
+}
@@ -0,0 +1,67 @@
+/**
+ * @file core/maths/Ray.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+#include <core/maths/Vector3.h>
+
+namespace Maths
+{
+	class Ray final
+	{
+	public:
+
+		Vector3 origin;
+
+		Ray() = default;
+
+		Ray(const Vector3& origin, const Vector3& direction);
+
+		Ray(const Ray& ray) = default;
+
+		Ray(Ray&& ray) = default;
+
+		~Ray() = default;
+
+		inline const Vector3& direction() const;
+
+		/**
+		 * Gets the component-wise reciprocal of the direction. Used by the slab
+		 * intersection tests.
+		 */
+		inline const Vector3& inverseDirection() const;
+
+		inline Vector3 point(const Float32 distance) const;
+
+		void setDirection(const Vector3& direction);
+
+		Ray& operator =(const Ray& ray) = default;
+
+		Ray& operator =(Ray&& ray) = default;
+
+	private:
+
+		Vector3 _direction;
+		Vector3 _inverseDirection;
+	};
+
+#include "inline/Ray.inl"
+}
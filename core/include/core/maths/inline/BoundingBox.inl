@@ -0,0 +1,92 @@
+/**
+ * @file core/maths/inline/BoundingBox.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+Vector3 BoundingBox::centre() const
+{
+	return 0.5f * (minimum + maximum);
+}
+
+Bool BoundingBox::contains(const Vector3& point) const
+{
+	return point.x >= minimum.x && point.x <= maximum.x &&
+		point.y >= minimum.y && point.y <= maximum.y &&
+		point.z >= minimum.z && point.z <= maximum.z;
+}
+
+Vector3 BoundingBox::extents() const
+{
+	return maximum - minimum;
+}
+
+void BoundingBox::include(const Vector3& point)
+{
+	minimum = Vector3::minimum(minimum, point);
+	maximum = Vector3::maximum(maximum, point);
+}
+
+void BoundingBox::include(const BoundingBox& boundingBox)
+{
+	minimum = Vector3::minimum(minimum, boundingBox.minimum);
+	maximum = Vector3::maximum(maximum, boundingBox.maximum);
+}
+
+Bool BoundingBox::intersects(const BoundingBox& boundingBox) const
+{
+	return minimum.x <= boundingBox.maximum.x && maximum.x >= boundingBox.minimum.x &&
+		minimum.y <= boundingBox.maximum.y && maximum.y >= boundingBox.minimum.y &&
+		minimum.z <= boundingBox.maximum.z && maximum.z >= boundingBox.minimum.z;
+}
+
+Bool BoundingBox::isEmpty() const
+{
+	return minimum.x > maximum.x || minimum.y > maximum.y || minimum.z > maximum.z;
+}
+
+Float32 BoundingBox::surfaceArea() const
+{
+	if(isEmpty())
+		return 0.0f;
+
+	const Vector3 size = extents();
+	return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+// Static
+
+BoundingBox BoundingBox::merge(const BoundingBox& boundingBoxA, const BoundingBox& boundingBoxB)
+{
+	return BoundingBox(Vector3::minimum(boundingBoxA.minimum, boundingBoxB.minimum),
+		Vector3::maximum(boundingBoxA.maximum, boundingBoxB.maximum));
+}
+
+
+// Maths
+
+Bool operator ==(const BoundingBox& boundingBoxA, const BoundingBox& boundingBoxB)
+{
+	return boundingBoxA.minimum == boundingBoxB.minimum && boundingBoxA.maximum == boundingBoxB.maximum;
+}
+
+Bool operator !=(const BoundingBox& boundingBoxA, const BoundingBox& boundingBoxB)
+{
+	return !(boundingBoxA == boundingBoxB);
+}
@@ -26,6 +26,9 @@ using namespace Core;
 
 void Application::deinitialise()
 {
+	_jobSystem.deinitialise();
+	_nameTable.deinitialise();
+
 #if defined(DE_INTERNAL_CONFIG_TRACK_ALLOCATIONS)
 	_allocationTracker.deinitialise();
 #endif
@@ -40,4 +43,7 @@ void Application::initialise()
 #if defined(DE_INTERNAL_CONFIG_TRACK_ALLOCATIONS)
 	_allocationTracker.initialise();
 #endif
+
+	_nameTable.initialise();
+	_jobSystem.initialise();
 }
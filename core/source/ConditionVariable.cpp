@@ -0,0 +1,54 @@
+/**
+ * @file core/ConditionVariable.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/ConditionVariable.h>
+#include <core/Futex.h>
+#include <core/Mutex.h>
+
+using namespace Core;
+
+// Public
+
+ConditionVariable::ConditionVariable()
+	: _sequence(0u) { }
+
+void ConditionVariable::notifyAll()
+{
+	_sequence.fetch_add(1u, std::memory_order_release);
+	Futex::wakeAll(_sequence);
+}
+
+void ConditionVariable::notifyOne()
+{
+	_sequence.fetch_add(1u, std::memory_order_release);
+	Futex::wakeOne(_sequence);
+}
+
+void ConditionVariable::wait(Mutex& mutex)
+{
+	// A notification between unlocking and waiting changes the sequence, in
+	// which case the futex does not block
+
+	const Uint32 sequence = _sequence.load(std::memory_order_relaxed);
+	_contentionCounter.increment();
+	mutex.unlock();
+	Futex::wait(_sequence, sequence);
+	mutex.lock();
+}
@@ -0,0 +1,72 @@
+/**
+ * @file core/Event.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Event.h>
+#include <core/Futex.h>
+
+using namespace Core;
+
+// Public
+
+Event::Event(const EventResetMode& resetMode, const Bool isSet)
+	: _state(isSet ? 1u : 0u),
+	  _waiterCount(0u),
+	  _resetMode(resetMode) { }
+
+void Event::reset()
+{
+	_state.store(0u, std::memory_order_release);
+}
+
+void Event::set()
+{
+	_state.store(1u, std::memory_order_seq_cst);
+
+	if(_waiterCount.load(std::memory_order_seq_cst) > 0u)
+	{
+		if(_resetMode == EventResetMode::Automatic)
+			Futex::wakeOne(_state);
+		else
+			Futex::wakeAll(_state);
+	}
+}
+
+Bool Event::tryWait()
+{
+	if(_resetMode == EventResetMode::Manual)
+		return isSet();
+
+	Uint32 state = 1u;
+	return _state.compare_exchange_strong(state, 0u, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void Event::wait()
+{
+	if(tryWait())
+		return;
+
+	_contentionCounter.increment();
+	_waiterCount.fetch_add(1u, std::memory_order_seq_cst);
+
+	while(!tryWait())
+		Futex::wait(_state, 0u);
+
+	_waiterCount.fetch_sub(1u, std::memory_order_relaxed);
+}
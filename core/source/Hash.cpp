@@ -0,0 +1,175 @@
+/**
+ * @file core/Hash.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <core/Hash.h>
+#include <core/Platform.h>
+
+#if DE_COMPILER == DE_COMPILER_MSVC && DE_ARCHITECTURE == DE_ARCHITECTURE_X64
+	#include <intrin.h>
+#endif
+
+using namespace Core;
+
+// External
+
+static const Uint64 SECRET[4] =
+{
+	0xA0761D6478BD642Full,
+	0xE7037ED1A0B428DBull,
+	0x8EBC6AF09C88C6E3ull,
+	0x589965CC75374CC3ull
+};
+
+static Uint64 mix(Uint64 a, Uint64 b);
+static void multiply(Uint64& a, Uint64& b);
+static Uint64 read3(const Uint8* data, const Uint size);
+static Uint64 read4(const Uint8* data);
+static Uint64 read8(const Uint8* data);
+
+
+// Core
+
+Uint64 Core::hashBytes(const Void* data, const Uint size, Uint64 seed)
+{
+	const Uint8* bytes = static_cast<const Uint8*>(data);
+	Uint64 a;
+	Uint64 b;
+	seed ^= ::mix(seed ^ ::SECRET[0], ::SECRET[1]);
+
+	if(size <= 16u)
+	{
+		if(size >= 4u)
+		{
+			const Uint offset = (size >> 3u) << 2u;
+			a = (::read4(bytes) << 32u) | ::read4(bytes + offset);
+			b = (::read4(bytes + size - 4u) << 32u) | ::read4(bytes + size - 4u - offset);
+		}
+		else if(size > 0u)
+		{
+			a = ::read3(bytes, size);
+			b = 0u;
+		}
+		else
+		{
+			a = 0u;
+			b = 0u;
+		}
+	}
+	else
+	{
+		Uint remainingSize = size;
+
+		if(remainingSize > 48u)
+		{
+			Uint64 seed1 = seed;
+			Uint64 seed2 = seed;
+
+			do
+			{
+				seed = ::mix(::read8(bytes) ^ ::SECRET[1], ::read8(bytes + 8u) ^ seed);
+				seed1 = ::mix(::read8(bytes + 16u) ^ ::SECRET[2], ::read8(bytes + 24u) ^ seed1);
+				seed2 = ::mix(::read8(bytes + 32u) ^ ::SECRET[3], ::read8(bytes + 40u) ^ seed2);
+				bytes += 48u;
+				remainingSize -= 48u;
+			}
+			while(remainingSize > 48u);
+
+			seed ^= seed1 ^ seed2;
+		}
+
+		while(remainingSize > 16u)
+		{
+			seed = ::mix(::read8(bytes) ^ ::SECRET[1], ::read8(bytes + 8u) ^ seed);
+			bytes += 16u;
+			remainingSize -= 16u;
+		}
+
+		// The last 16 bytes are read from the end, overlapping the previous
+		// block if needed
+
+		a = ::read8(bytes + remainingSize - 16u);
+		b = ::read8(bytes + remainingSize - 8u);
+	}
+
+	a ^= ::SECRET[1];
+	b ^= seed;
+	::multiply(a, b);
+
+	return ::mix(a ^ ::SECRET[0] ^ static_cast<Uint64>(size), b ^ ::SECRET[1]);
+}
+
+
+// External
+
+static Uint64 mix(Uint64 a, Uint64 b)
+{
+	::multiply(a, b);
+	return a ^ b;
+}
+
+static void multiply(Uint64& a, Uint64& b)
+{
+	// Computes the full 128-bit product, storing the low half in a and the
+	// high half in b
+
+#if defined(__SIZEOF_INT128__)
+	__extension__ using Uint128 = unsigned __int128;
+	const Uint128 product = static_cast<Uint128>(a) * b;
+	a = static_cast<Uint64>(product);
+	b = static_cast<Uint64>(product >> 64u);
+#elif DE_COMPILER == DE_COMPILER_MSVC && DE_ARCHITECTURE == DE_ARCHITECTURE_X64
+	a = _umul128(a, b, &b);
+#else
+	const Uint64 aHigh = a >> 32u;
+	const Uint64 aLow = a & 0xFFFFFFFFu;
+	const Uint64 bHigh = b >> 32u;
+	const Uint64 bLow = b & 0xFFFFFFFFu;
+	const Uint64 highHigh = aHigh * bHigh;
+	const Uint64 highLow = aHigh * bLow;
+	const Uint64 lowHigh = aLow * bHigh;
+	const Uint64 lowLow = aLow * bLow;
+	const Uint64 middle = (lowLow >> 32u) + (highLow & 0xFFFFFFFFu) + (lowHigh & 0xFFFFFFFFu);
+	a = (middle << 32u) | (lowLow & 0xFFFFFFFFu);
+	b = highHigh + (highLow >> 32u) + (lowHigh >> 32u) + (middle >> 32u);
+#endif
+}
+
+static Uint64 read3(const Uint8* data, const Uint size)
+{
+	return (static_cast<Uint64>(data[0]) << 16u) | (static_cast<Uint64>(data[size >> 1u]) << 8u) |
+		static_cast<Uint64>(data[size - 1u]);
+}
+
+static Uint64 read4(const Uint8* data)
+{
+	Uint32 value;
+	std::memcpy(&value, data, sizeof(Uint32));
+
+	return value;
+}
+
+static Uint64 read8(const Uint8* data)
+{
+	Uint64 value;
+	std::memcpy(&value, data, sizeof(Uint64));
+
+	return value;
+}
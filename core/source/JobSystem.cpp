@@ -0,0 +1,471 @@
+/**
+ * @file core/JobSystem.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <core/Array.h>
+#include <core/Config.h>
+#include <core/Futex.h>
+#include <core/JobSystem.h>
+#include <core/Log.h>
+#include <core/Memory.h>
+#include <core/Numeric.h>
+#include <core/Semaphore.h>
+#include <core/Thread.h>
+#include <core/debug/Assert.h>
+
+using namespace Core;
+
+// External
+
+static const Uint32 INVALID_THREAD_INDEX = Numeric<Uint32>::maximum();
+static const Uint32 JOB_INDEX_MASK = Config::JOB_SYSTEM_MAX_JOB_COUNT - 1u;
+
+static_assert((Config::JOB_SYSTEM_MAX_JOB_COUNT & ::JOB_INDEX_MASK) == 0u,
+	"Config::JOB_SYSTEM_MAX_JOB_COUNT must be a power of two.");
+
+static thread_local Uint32 threadIndex = ::INVALID_THREAD_INDEX;
+static thread_local Uint32 allocatedJobCount = 0u;
+static thread_local Uint32 randomState = 0u;
+
+static std::atomic<Bool> isRunning(false);
+static std::atomic<Uint32> sleepingWorkerCount(0u);
+static std::atomic<Uint32> waitingThreadCount(0u);
+static Semaphore workerSemaphore;
+
+static Uint32 nextRandom();
+
+
+// Job
+
+class Core::Job final
+{
+public:
+
+	JobSystem::JobFunction function;
+	Void* parameter;
+	Job* parent;
+	std::atomic<Uint32> unfinishedJobCount;
+
+	JobSystem::ParallelForFunction rangeFunction;
+	Void* rangeParameter;
+	Uint32 rangeBegin;
+	Uint32 rangeEnd;
+	Uint32 batchSize;
+};
+
+
+// Queue
+
+/**
+ * Chase-Lev work-stealing deque of a fixed capacity. The owning thread
+ * pushes and pops at the bottom while the other threads steal from the top.
+ */
+class JobSystem::Queue final
+{
+public:
+
+	Queue()
+		: _bottom(0),
+		  _top(0)
+	{
+		for(std::atomic<Job*>& job : _jobs)
+			job.store(nullptr, std::memory_order_relaxed);
+	}
+
+	Queue(const Queue& queue) = delete;
+	Queue(Queue&& queue) = delete;
+
+	~Queue() = default;
+
+	Job* pop()
+	{
+		const Int64 bottom = _bottom.load(std::memory_order_relaxed) - 1;
+		_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		Int64 top = _top.load(std::memory_order_relaxed);
+
+		if(top > bottom)
+		{
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Job* job = _jobs[bottom & ::JOB_INDEX_MASK].load(std::memory_order_relaxed);
+
+		if(top == bottom)
+		{
+			// The last job, race against the stealing threads
+
+			if(!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+				std::memory_order_relaxed))
+			{
+				job = nullptr;
+			}
+
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		return job;
+	}
+
+	void push(Job* job)
+	{
+		const Int64 bottom = _bottom.load(std::memory_order_relaxed);
+		DE_ASSERT(bottom - _top.load(std::memory_order_acquire) < Config::JOB_SYSTEM_MAX_JOB_COUNT);
+		_jobs[bottom & ::JOB_INDEX_MASK].store(job, std::memory_order_relaxed);
+		_bottom.store(bottom + 1, std::memory_order_release);
+	}
+
+	Job* steal()
+	{
+		Int64 top = _top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const Int64 bottom = _bottom.load(std::memory_order_acquire);
+
+		if(top >= bottom)
+			return nullptr;
+
+		Job* job = _jobs[top & ::JOB_INDEX_MASK].load(std::memory_order_relaxed);
+
+		if(!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+
+		return job;
+	}
+
+	Queue& operator =(const Queue& queue) = delete;
+	Queue& operator =(Queue&& queue) = delete;
+
+private:
+
+	// The indices are kept on separate cache lines, as the owner writes the
+	// bottom and the thieves the top
+
+	std::atomic<Int64> _bottom;
+	Uint8 _bottomPadding[CACHE_LINE_SIZE - sizeof(std::atomic<Int64>)];
+	std::atomic<Int64> _top;
+	Uint8 _topPadding[CACHE_LINE_SIZE - sizeof(std::atomic<Int64>)];
+	Array<std::atomic<Job*>, Config::JOB_SYSTEM_MAX_JOB_COUNT> _jobs;
+};
+
+
+// Public
+
+JobSystem::JobSystem()
+	: _jobs(nullptr),
+	  _queues(nullptr),
+	  _workers(nullptr),
+	  _workerCount(0u) { }
+
+Job* JobSystem::createJob(JobFunction function, Void* parameter, Job* parent)
+{
+	DE_ASSERT(function != nullptr);
+	Job* job = allocateJob();
+	job->function = function;
+	job->parameter = parameter;
+	job->parent = parent;
+	job->unfinishedJobCount.store(1u, std::memory_order_relaxed);
+
+	if(parent != nullptr)
+		parent->unfinishedJobCount.fetch_add(1u, std::memory_order_relaxed);
+
+	return job;
+}
+
+void JobSystem::deinitialise()
+{
+	defaultLog << LogLevel::Debug << "JobSystem deinitialising..." << Log::Flush();
+	::isRunning.store(false, std::memory_order_seq_cst);
+	::workerSemaphore.release(_workerCount);
+
+	for(Uint32 i = 0u; i < _workerCount; ++i)
+		_workers[i].join();
+
+	DE_DELETE_ARRAY(_workers, Thread, _workerCount);
+	DE_DELETE_ARRAY(_queues, Queue, _workerCount + 1u);
+	DE_DELETE_ARRAY(_jobs, Job, (_workerCount + 1u) * Config::JOB_SYSTEM_MAX_JOB_COUNT);
+	_workers = nullptr;
+	_queues = nullptr;
+	_jobs = nullptr;
+	_workerCount = 0u;
+	::threadIndex = ::INVALID_THREAD_INDEX;
+}
+
+void JobSystem::initialise()
+{
+	_workerCount = Config::JOB_SYSTEM_WORKER_COUNT;
+
+	if(_workerCount == 0u)
+	{
+		const Uint32 hardwareThreadCount = Thread::hardwareConcurrency();
+		_workerCount = hardwareThreadCount > 1u ? hardwareThreadCount - 1u : 1u;
+	}
+
+	const Uint32 threadCount = _workerCount + 1u;
+	_jobs = DE_NEW_ARRAY(Job, threadCount * Config::JOB_SYSTEM_MAX_JOB_COUNT);
+	_queues = DE_NEW_ARRAY(Queue, threadCount);
+	_workers = DE_NEW_ARRAY(Thread, _workerCount);
+	::threadIndex = 0u;
+	::randomState = 1u;
+	::isRunning.store(true, std::memory_order_release);
+
+	ThreadOptions options;
+	options.name = "JobWorker";
+
+	for(Uint32 i = 0u; i < _workerCount; ++i)
+		_workers[i].run(workerEntry, reinterpret_cast<Void*>(static_cast<Uint>(i + 1u)), options);
+
+	defaultLog << LogLevel::Debug << "JobSystem initialised with " << _workerCount << " worker threads." <<
+		Log::Flush();
+}
+
+Bool JobSystem::isFinished(const Job* job) const
+{
+	DE_ASSERT(job != nullptr);
+	return job->unfinishedJobCount.load(std::memory_order_acquire) == 0u;
+}
+
+void JobSystem::parallelFor(const Uint32 count, const Uint32 batchSize, ParallelForFunction function,
+	Void* parameter)
+{
+	DE_ASSERT(batchSize > 0u);
+	DE_ASSERT(function != nullptr);
+
+	if(count == 0u)
+		return;
+
+	Job* job = createJob(parallelForJob, nullptr);
+	job->parameter = job;
+	job->rangeFunction = function;
+	job->rangeParameter = parameter;
+	job->rangeBegin = 0u;
+	job->rangeEnd = count;
+	job->batchSize = batchSize;
+	run(job);
+	wait(job);
+}
+
+void JobSystem::run(Job* job)
+{
+	DE_ASSERT(job != nullptr);
+	DE_ASSERT(::threadIndex != ::INVALID_THREAD_INDEX);
+	_queues[::threadIndex].push(job);
+
+	// Pairs with the sleeping worker counting itself before checking the
+	// queues a last time, so either the worker finds the job or is woken
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if(::sleepingWorkerCount.load(std::memory_order_relaxed) > 0u)
+		::workerSemaphore.release();
+}
+
+void JobSystem::wait(const Job* job)
+{
+	Uint32 spinCount = 0u;
+
+	while(!isFinished(job))
+	{
+		Job* nextJob = getJob();
+
+		if(nextJob != nullptr)
+		{
+			execute(nextJob);
+			spinCount = 0u;
+		}
+		else if(++spinCount < Config::JOB_SYSTEM_SPIN_COUNT)
+		{
+			Thread::yield();
+		}
+		else
+		{
+			// Nothing is pushed to the own queue while waiting, so leave the
+			// remaining jobs to the workers and sleep until the job finishes
+
+			Job* waitedJob = const_cast<Job*>(job);
+			::waitingThreadCount.fetch_add(1u, std::memory_order_seq_cst);
+			const Uint32 unfinishedJobCount = waitedJob->unfinishedJobCount.load(std::memory_order_seq_cst);
+
+			if(unfinishedJobCount != 0u)
+				Futex::wait(waitedJob->unfinishedJobCount, unfinishedJobCount);
+
+			::waitingThreadCount.fetch_sub(1u, std::memory_order_relaxed);
+			spinCount = 0u;
+		}
+	}
+}
+
+
+// Private
+
+Job* JobSystem::allocateJob()
+{
+	DE_ASSERT(::threadIndex != ::INVALID_THREAD_INDEX);
+	const Uint32 jobIndex = ::allocatedJobCount++ & ::JOB_INDEX_MASK;
+	Job* job = &_jobs[::threadIndex * Config::JOB_SYSTEM_MAX_JOB_COUNT + jobIndex];
+
+	// The pool is a ring, so the slot is reused without further bookkeeping.
+	// A slot still in flight means the thread exceeded the job count limit.
+
+	DE_ASSERT(isFinished(job));
+	return job;
+}
+
+void JobSystem::execute(Job* job)
+{
+	job->function(job->parameter);
+	finish(job);
+}
+
+void JobSystem::finish(Job* job)
+{
+	// The job may be reused as soon as it has finished, so the parent is read beforehand
+
+	Job* parent = job->parent;
+	const Uint32 unfinishedJobCount = job->unfinishedJobCount.fetch_sub(1u, std::memory_order_seq_cst) - 1u;
+
+	if(unfinishedJobCount != 0u)
+		return;
+
+	if(::waitingThreadCount.load(std::memory_order_seq_cst) > 0u)
+		Futex::wakeAll(job->unfinishedJobCount);
+
+	if(parent != nullptr)
+		finish(parent);
+}
+
+Job* JobSystem::getJob()
+{
+	const Uint32 threadIndex = ::threadIndex;
+	DE_ASSERT(threadIndex != ::INVALID_THREAD_INDEX);
+	Job* job = _queues[threadIndex].pop();
+
+	if(job != nullptr)
+		return job;
+
+	const Uint32 queueIndex = ::nextRandom() % (_workerCount + 1u);
+
+	if(queueIndex == threadIndex)
+		return nullptr;
+
+	return _queues[queueIndex].steal();
+}
+
+Job* JobSystem::stealJob()
+{
+	for(Uint32 i = 0u; i <= _workerCount; ++i)
+	{
+		if(i == ::threadIndex)
+			continue;
+
+		Job* job = _queues[i].steal();
+
+		if(job != nullptr)
+			return job;
+	}
+
+	return nullptr;
+}
+
+// Static
+
+void JobSystem::parallelForJob(Void* parameter)
+{
+	Job* job = static_cast<Job*>(parameter);
+
+	if(job->rangeEnd - job->rangeBegin <= job->batchSize)
+	{
+		job->rangeFunction(job->rangeBegin, job->rangeEnd, job->rangeParameter);
+		return;
+	}
+
+	JobSystem& jobSystem = instance();
+	const Uint32 middle = job->rangeBegin + (job->rangeEnd - job->rangeBegin) / 2u;
+
+	for(Uint32 i = 0u; i < 2u; ++i)
+	{
+		Job* childJob = jobSystem.createJob(parallelForJob, nullptr, job);
+		childJob->parameter = childJob;
+		childJob->rangeFunction = job->rangeFunction;
+		childJob->rangeParameter = job->rangeParameter;
+		childJob->rangeBegin = i == 0u ? job->rangeBegin : middle;
+		childJob->rangeEnd = i == 0u ? middle : job->rangeEnd;
+		childJob->batchSize = job->batchSize;
+		jobSystem.run(childJob);
+	}
+}
+
+Int32 JobSystem::workerEntry(Void* parameter)
+{
+	::threadIndex = static_cast<Uint32>(reinterpret_cast<Uint>(parameter));
+	::randomState = ::threadIndex + 1u;
+	JobSystem& jobSystem = instance();
+	Uint32 spinCount = 0u;
+
+	while(::isRunning.load(std::memory_order_acquire))
+	{
+		Job* job = jobSystem.getJob();
+
+		if(job != nullptr)
+		{
+			jobSystem.execute(job);
+			spinCount = 0u;
+		}
+		else if(++spinCount < Config::JOB_SYSTEM_SPIN_COUNT)
+		{
+			Thread::yield();
+		}
+		else
+		{
+			// Announce the sleep before looking for a job a last time, so a
+			// concurrent run() either is seen here or releases the semaphore
+
+			::sleepingWorkerCount.fetch_add(1u, std::memory_order_seq_cst);
+			job = jobSystem.stealJob();
+
+			if(job == nullptr && ::isRunning.load(std::memory_order_seq_cst))
+				::workerSemaphore.acquire();
+
+			::sleepingWorkerCount.fetch_sub(1u, std::memory_order_relaxed);
+
+			if(job != nullptr)
+				jobSystem.execute(job);
+
+			spinCount = 0u;
+		}
+	}
+
+	return 0;
+}
+
+
+// External
+
+static Uint32 nextRandom()
+{
+	// Xorshift
+
+	Uint32 state = ::randomState;
+	state ^= state << 13u;
+	state ^= state >> 17u;
+	state ^= state << 5u;
+	::randomState = state;
+	return state;
+}
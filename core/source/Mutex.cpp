@@ -0,0 +1,69 @@
+/**
+ * @file core/Mutex.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <emmintrin.h>
+#include <core/Futex.h>
+#include <core/Mutex.h>
+
+using namespace Core;
+
+// External
+
+static const Uint32 SPIN_COUNT = 64u;
+
+
+// Public
+
+Mutex::Mutex()
+	: _state(0u) { }
+
+
+// Private
+
+void Mutex::lockContended()
+{
+	// Spin briefly, as the mutex is likely to be held only for a short time
+
+	for(Uint32 i = 0u; i < ::SPIN_COUNT; ++i)
+	{
+		_mm_pause();
+		Uint32 state = 0u;
+
+		if(_state.load(std::memory_order_relaxed) == 0u &&
+			_state.compare_exchange_weak(state, 1u, std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+
+	_contentionCounter.increment();
+
+	// The state is set to 2 by every waiter, so the unlocking thread knows to
+	// wake one of them
+
+	while(_state.exchange(2u, std::memory_order_acquire) != 0u)
+		Futex::wait(_state, 2u);
+}
+
+void Mutex::unlockContended()
+{
+	_state.store(0u, std::memory_order_release);
+	Futex::wakeOne(_state);
+}
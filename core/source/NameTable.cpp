@@ -0,0 +1,130 @@
+/**
+ * @file core/NameTable.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <core/Error.h>
+#include <core/Hash.h>
+#include <core/Log.h>
+#include <core/Memory.h>
+#include <core/NameTable.h>
+#include <core/ScopedLock.h>
+
+using namespace Core;
+
+// External
+
+static const Char8* COMPONENT_TAG = "[Core::NameTable] ";
+
+
+// Public
+
+NameTable::NameTable()
+	: _characterBlockOffset(0u),
+	  _size(0u)
+{
+	_entryBlocks.fill(nullptr);
+}
+
+void NameTable::deinitialise()
+{
+	defaultLog << LogLevel::Debug << "NameTable deinitialising with " << size() << " names..." << Log::Flush();
+
+	for(Uint32 i = 0u; i < MAX_ENTRY_BLOCK_COUNT && _entryBlocks[i] != nullptr; ++i)
+	{
+		DE_DELETE_ARRAY(_entryBlocks[i], Entry, ENTRY_BLOCK_SIZE);
+		_entryBlocks[i] = nullptr;
+	}
+
+	for(Vector<CharacterBlock>::const_iterator i = _characterBlocks.begin(), end = _characterBlocks.end();
+		i != end; ++i)
+	{
+		DE_DELETE_ARRAY(i->characters, Char8, i->size);
+	}
+
+	// Assigning empty containers releases the memory, unlike clearing
+
+	_characterBlocks = Vector<CharacterBlock>();
+	_indices = FlatMap<StringView8, Uint32>();
+	_characterBlockOffset = 0u;
+	_size.store(0u, std::memory_order_relaxed);
+}
+
+void NameTable::initialise()
+{
+	const Uint32 emptyIndex = intern(StringView8("", 0u));
+	DE_ASSERT(emptyIndex == 0u);
+	static_cast<Void>(emptyIndex);
+	defaultLog << LogLevel::Debug << "NameTable initialised." << Log::Flush();
+}
+
+Uint32 NameTable::intern(const StringView8& string)
+{
+	ScopedLock<Mutex> lock(_mutex);
+	const FlatMap<StringView8, Uint32>::const_iterator iterator = _indices.find(string);
+
+	if(iterator != _indices.end())
+		return iterator->second;
+
+	const Uint32 index = _size.load(std::memory_order_relaxed);
+	const Uint32 blockIndex = index / ENTRY_BLOCK_SIZE;
+
+	if(blockIndex >= MAX_ENTRY_BLOCK_COUNT)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to intern a name, the table is full." <<
+			Log::Flush();
+
+		DE_ERROR(0x0);
+	}
+
+	if(_entryBlocks[blockIndex] == nullptr)
+		_entryBlocks[blockIndex] = DE_NEW_ARRAY(Entry, ENTRY_BLOCK_SIZE);
+
+	Entry& entry = _entryBlocks[blockIndex][index % ENTRY_BLOCK_SIZE];
+	entry.characters = storeCharacters(string);
+	entry.length = static_cast<Uint32>(string.size());
+	entry.hash = static_cast<Uint32>(hashBytes(string.data(), string.size()));
+	_indices.emplace(StringView8(entry.characters, entry.length), index);
+	_size.store(index + 1u, std::memory_order_release);
+
+	return index;
+}
+
+// Private
+
+const Char8* NameTable::storeCharacters(const StringView8& string)
+{
+	const Uint size = string.size() + 1u;
+
+	if(_characterBlocks.empty() || _characterBlockOffset + size > _characterBlocks.back().size)
+	{
+		CharacterBlock block;
+		block.size = size > CHARACTER_BLOCK_SIZE ? size : CHARACTER_BLOCK_SIZE;
+		block.characters = DE_NEW_ARRAY(Char8, block.size);
+		_characterBlocks.push_back(block);
+		_characterBlockOffset = 0u;
+	}
+
+	Char8* characters = _characterBlocks.back().characters + _characterBlockOffset;
+	std::memcpy(characters, string.data(), string.size());
+	characters[string.size()] = '\0';
+	_characterBlockOffset += size;
+
+	return characters;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file core/Semaphore.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Futex.h>
+#include <core/Semaphore.h>
+#include <core/debug/Assert.h>
+
+using namespace Core;
+
+// Public
+
+Semaphore::Semaphore(const Uint32 initialCount)
+	: _count(initialCount),
+	  _waiterCount(0u) { }
+
+void Semaphore::acquire()
+{
+	if(tryAcquire())
+		return;
+
+	_contentionCounter.increment();
+	_waiterCount.fetch_add(1u, std::memory_order_seq_cst);
+
+	while(!tryAcquire())
+		Futex::wait(_count, 0u);
+
+	_waiterCount.fetch_sub(1u, std::memory_order_relaxed);
+}
+
+void Semaphore::release(const Uint32 count)
+{
+	DE_ASSERT(count > 0u);
+	_count.fetch_add(count, std::memory_order_seq_cst);
+
+	if(_waiterCount.load(std::memory_order_seq_cst) > 0u)
+	{
+		if(count == 1u)
+			Futex::wakeOne(_count);
+		else
+			Futex::wakeAll(_count);
+	}
+}
+
+Bool Semaphore::tryAcquire()
+{
+	Uint32 count = _count.load(std::memory_order_relaxed);
+
+	while(count > 0u)
+	{
+		if(_count.compare_exchange_weak(count, count - 1u, std::memory_order_acquire,
+			std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file core/SpinLock.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <emmintrin.h>
+#include <core/SpinLock.h>
+#include <core/Thread.h>
+#include <core/maths/Utility.h>
+
+using namespace Core;
+
+// External
+
+static const Uint32 INITIAL_SPIN_COUNT = 64u;
+static const Uint32 MAX_SPIN_COUNT	   = 4096u;
+
+static Uint32 averageSpinCount(const Uint32 average, const Uint32 spinCount);
+
+
+// Public
+
+SpinLock::SpinLock()
+	: _isLocked(false),
+	  _spinCount(::INITIAL_SPIN_COUNT) { }
+
+
+// Private
+
+void SpinLock::lockContended()
+{
+	_contentionCounter.increment();
+
+	// Spin up to twice the average of the previous acquisitions
+
+	const Uint32 spinCount = _spinCount.load(std::memory_order_relaxed);
+	const Uint32 maxSpinCount = Maths::minimum(2u * spinCount + 16u, ::MAX_SPIN_COUNT);
+
+	for(Uint32 i = 0u; i < maxSpinCount; ++i)
+	{
+		_mm_pause();
+
+		if(tryLock())
+		{
+			_spinCount.store(::averageSpinCount(spinCount, i), std::memory_order_relaxed);
+			return;
+		}
+	}
+
+	_spinCount.store(::averageSpinCount(spinCount, maxSpinCount), std::memory_order_relaxed);
+
+	while(!tryLock())
+		Thread::yield();
+}
+
+
+// External
+
+static Uint32 averageSpinCount(const Uint32 average, const Uint32 spinCount)
+{
+	const Int32 difference = static_cast<Int32>(spinCount) - static_cast<Int32>(average);
+	return static_cast<Uint32>(static_cast<Int32>(average) + difference / 8);
+}
@@ -18,60 +18,54 @@
  * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <codecvt>
-#include <locale>
+#include <core/Error.h>
+#include <core/Log.h>
 #include <core/String.h>
+#include <core/Unicode.h>
 
 using namespace Core;
-using namespace Memory;
 
 // External
 
-// Temporary workaround for a bug in MSVC 1900
-
-#if DE_COMPILER == DE_COMPILER_MSVC && DE_COMPILER_VERSION == 1900
-	#define DE_INTERNAL_COMPILER_MSVC_1900
-#endif
-
-#include <core/Platform.h>
-
-#if defined(DE_INTERNAL_COMPILER_MSVC_1900)
-
-using StringConverter =
-	std::wstring_convert<std::codecvt_utf8_utf16<Int16>, Int16, STDAllocator<Int16>, STDAllocator<Char8>>;
-
-#else
-
-using StringConverter =
-	std::wstring_convert<std::codecvt_utf8_utf16<Char16>, Char16, STDAllocator<Char16>, STDAllocator<Char8>>;
-
-#endif
+static const Char8* COMPONENT_TAG = "[Core::String] ";
 
 
 // Core
 
 String8 Core::toString8(const String16& string)
 {
-	StringConverter converter;
+	String8 convertedString;
+	const Uint length = Unicode::toUtf8Length(string.data(), string.length());
+
+	if(length == Unicode::INVALID_LENGTH)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to convert an invalid UTF-16 string." <<
+			Log::Flush();
+
+		DE_ERROR(0x0);
+	}
 
-	// Temporary workaround for a bug in MSVC 1900
+	convertedString.resize(length);
+	Unicode::toUtf8(string.data(), string.length(), &convertedString[0], length);
 
-#if defined(DE_INTERNAL_COMPILER_MSVC_1900)
-	return converter.to_bytes(reinterpret_cast<const Int16*>(string.c_str()));
-#else
-	return converter.to_bytes(string);
-#endif
+	return convertedString;
 }
 
 String16 Core::toString16(const String8& string)
 {
-	StringConverter converter;
+	String16 convertedString;
+	const Uint length = Unicode::toUtf16Length(string.data(), string.length());
+
+	if(length == Unicode::INVALID_LENGTH)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to convert an invalid UTF-8 string." <<
+			Log::Flush();
+
+		DE_ERROR(0x0);
+	}
 
-	// Temporary workaround for a bug in MSVC 1900
+	convertedString.resize(length);
+	Unicode::toUtf16(string.data(), string.length(), &convertedString[0], length);
 
-#if defined(DE_INTERNAL_COMPILER_MSVC_1900)
-	return reinterpret_cast<const Char16*>(converter.from_bytes(string).c_str());
-#else
-	return converter.from_bytes(string);
-#endif
+	return convertedString;
 }
@@ -0,0 +1,128 @@
+/**
+ * @file core/TokenStream.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <core/FileStream.h>
+#include <core/TokenStream.h>
+#include <core/debug/Assert.h>
+
+using namespace Core;
+
+// Public
+
+TokenStream::TokenStream(const Tokeniser& tokeniser, FileStream& fileStream, const Uint32 bufferSize)
+	: _tokeniser(tokeniser),
+	  _fileStream(&fileStream),
+	  _buffer(bufferSize),
+	  _data(_buffer.data()),
+	  _position(0u),
+	  _size(0u)
+{
+	DE_ASSERT(bufferSize > 0u);
+}
+
+TokenStream::TokenStream(const Tokeniser& tokeniser, const StringView8& source)
+	: _tokeniser(tokeniser),
+	  _fileStream(nullptr),
+	  _data(source.data()),
+	  _position(0u),
+	  _size(source.size()) { }
+
+Bool TokenStream::next(TokenView& token)
+{
+	using CharacterClass = Tokeniser::CharacterClass;
+
+	for(;;)
+	{
+		if(_position == _size && !refill(_position))
+			return false;
+
+		const CharacterClass characterClass = _tokeniser.classify(_data[_position]);
+
+		if(characterClass == CharacterClass::Delimiter)
+		{
+			token.lexeme = StringView8(_data + _position, 1u);
+			token.type = Token::Type::Delimiter;
+			++_position;
+
+			return true;
+		}
+		else if(characterClass == CharacterClass::Other)
+		{
+			Uint lexemePosition = _position;
+
+			for(;;)
+			{
+				++_position;
+
+				if(_position == _size)
+				{
+					// A lexeme reaching the end of the buffer may continue in
+					// the next chunk, so it is kept when refilling
+
+					const Uint lexemeLength = _position - lexemePosition;
+					const Bool isRefilled = refill(lexemePosition);
+					lexemePosition = _position - lexemeLength;
+
+					if(!isRefilled)
+						break;
+				}
+
+				if(_tokeniser.classify(_data[_position]) != CharacterClass::Other)
+					break;
+			}
+
+			token.lexeme = StringView8(_data + lexemePosition, _position - lexemePosition);
+			token.type = Token::Type::Unknown;
+
+			return true;
+		}
+
+		++_position;
+	}
+}
+
+// Private
+
+Bool TokenStream::refill(const Uint keepPosition)
+{
+	if(_fileStream == nullptr)
+		return false;
+
+	// The characters from keepPosition onwards are moved to the front of the
+	// buffer, and the buffer grows if they fill it
+
+	const Uint keptSize = _size - keepPosition;
+
+	if(keptSize > 0u)
+		std::memmove(_buffer.data(), _buffer.data() + keepPosition, keptSize);
+
+	if(keptSize == _buffer.size())
+		_buffer.resize(2u * _buffer.size());
+
+	_data = _buffer.data();
+	const Uint32 readSize = _fileStream->read(reinterpret_cast<Uint8*>(_buffer.data() + keptSize),
+		static_cast<Uint32>(_buffer.size() - keptSize));
+
+	_position = keptSize;
+	_size = keptSize + readSize;
+
+	return readSize > 0u;
+}
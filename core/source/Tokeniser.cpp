@@ -19,49 +19,62 @@
  */
 
 #include <core/Tokeniser.h>
-#include <core/maths/Utility.h>
 
 using namespace Core;
-using namespace Maths;
 
 // Public
 
 Tokeniser::Tokeniser(const String8& delimiterCharacters, const String8& whitespaceCharacters)
-	: _delimiterCharacters(delimiterCharacters),
-	  _whitespaceCharacters(whitespaceCharacters),
-	  _tokenStream(nullptr)
 {
-	_whitespaceCharacters.append(1u, '\r');
+	_characterClasses.fill(CharacterClass::Other);
+
+	for(String8::const_iterator i = delimiterCharacters.begin(), end = delimiterCharacters.end(); i != end; ++i)
+		_characterClasses[static_cast<Uint8>(*i)] = CharacterClass::Delimiter;
+
+	// Whitespace takes precedence over delimiters
+
+	for(String8::const_iterator i = whitespaceCharacters.begin(), end = whitespaceCharacters.end(); i != end;
+		++i)
+	{
+		_characterClasses[static_cast<Uint8>(*i)] = CharacterClass::Whitespace;
+	}
+
+	_characterClasses[static_cast<Uint8>('\r')] = CharacterClass::Whitespace;
 }
 
-const TokenList& Tokeniser::tokenise(const String8& tokenStream)
+const TokenList& Tokeniser::tokenise(const StringView8& tokenStream)
 {
-	_tokenStream = &tokenStream;
+	_tokenStream = tokenStream;
 	_tokens.clear();
+	const Char8* stream = tokenStream.data();
+	const Uint streamEndPosition = tokenStream.size();
 	Uint streamPosition = 0u;
-	const Uint streamEndPosition = _tokenStream->length();
 
 	while(streamPosition < streamEndPosition)
 	{
-		if(!isWhitespaceCharacter(streamPosition))
+		const CharacterClass characterClass = classify(stream[streamPosition]);
+
+		if(characterClass == CharacterClass::Delimiter)
+		{
+			addToken(Token::Type::Delimiter, streamPosition, 1u);
+			++streamPosition;
+		}
+		else if(characterClass == CharacterClass::Other)
 		{
-			if(isDelimiterCharacter(streamPosition))
+			const Uint lexemePosition = streamPosition;
+
+			do
 			{
-				addToken(Token::Type::Delimiter, streamPosition, 1u);
+				++streamPosition;
 			}
-			else
-			{
-				Uint delimiterPosition = findNextDelimiterPosition(streamPosition);
+			while(streamPosition < streamEndPosition && classify(stream[streamPosition]) == CharacterClass::Other);
 
-				if(delimiterPosition == String8::npos)
-					delimiterPosition = streamEndPosition;
-
-				addToken(Token::Type::Unknown, streamPosition, delimiterPosition - streamPosition);
-				streamPosition = delimiterPosition - 1u;
-			}
+			addToken(Token::Type::Unknown, lexemePosition, streamPosition - lexemePosition);
+		}
+		else
+		{
+			++streamPosition;
 		}
-
-		++streamPosition;
 	}
 
 	return _tokens;
@@ -69,46 +82,11 @@ const TokenList& Tokeniser::tokenise(const String8& tokenStream)
 
 // Private
 
-Bool Tokeniser::isWhitespaceCharacter(const Uint streamPosition) const
-{
-	const Char8 character = (*_tokenStream)[streamPosition];
-
-	for(String8::const_iterator i = _whitespaceCharacters.begin(), end = _whitespaceCharacters.end();
-		i != end; ++i)
-	{
-		if(*i == character)
-			return true;
-	}
-
-	return false;
-}
-
-Bool Tokeniser::isDelimiterCharacter(const Uint streamPosition) const
-{
-	const Char8 character = (*_tokenStream)[streamPosition];
-
-	for(String8::const_iterator i = _delimiterCharacters.begin(), end = _delimiterCharacters.end(); i != end;
-		++i)
-	{
-		if(*i == character)
-			return true;
-	}
-
-	return false;
-}
-
 void Tokeniser::addToken(const Token::Type& type, const Uint streamPosition, const Uint lexemeLength)
 {
 	Token token;
-	token.lexeme.assign(*_tokenStream, streamPosition, lexemeLength);
+	token.offset = static_cast<Uint32>(streamPosition);
+	token.length = static_cast<Uint32>(lexemeLength);
 	token.type = type;
-	_tokens.emplace_back(token);
-}
-
-Uint Tokeniser::findNextDelimiterPosition(const Uint streamPosition) const
-{
-	const Uint whitespacePosition = _tokenStream->find_first_of(_whitespaceCharacters, streamPosition);
-	Uint delimiterPosition = _tokenStream->find_first_of(_delimiterCharacters, streamPosition);
-
-	return minimum(whitespacePosition, delimiterPosition);
+	_tokens.push_back(token);
 }
@@ -0,0 +1,481 @@
+/**
+ * @file core/Unicode.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <emmintrin.h>
+#include <core/Unicode.h>
+
+using namespace Core;
+
+// External
+
+static const Char32 MAX_CODE_POINT = 0x10FFFFu;
+
+static Bool decode(const Char8*& input, const Char8* inputEnd, Char32& codePoint);
+static Bool decode(const Char16*& input, const Char16* inputEnd, Char32& codePoint);
+static Bool decode(const Char32*& input, const Char32* inputEnd, Char32& codePoint);
+static Uint encode(const Char32 codePoint, Char8* output);
+static Uint encode(const Char32 codePoint, Char16* output);
+static Uint encode(const Char32 codePoint, Char32* output);
+static Uint encodedLength(const Char32 codePoint, const Char8* output);
+static Uint encodedLength(const Char32 codePoint, const Char16* output);
+static Uint encodedLength(const Char32 codePoint, const Char32* output);
+static Bool isContinuationByte(const Char8 character);
+static Bool isSurrogate(const Char32 codePoint);
+
+template<typename Input>
+static Uint countAscii(const Input* input, const Uint length);
+
+template<>
+Uint countAscii(const Char8* input, const Uint length);
+
+template<>
+Uint countAscii(const Char16* input, const Uint length);
+
+template<typename Input, typename Output>
+static Uint transcode(const Input* input, const Uint length, Output* output, const Uint outputSize);
+
+template<typename Input, typename Output>
+static Uint transcodeAscii(const Input* input, const Uint length, Output* output, const Uint outputSize);
+
+template<>
+Uint transcodeAscii(const Char8* input, const Uint length, Char16* output, const Uint outputSize);
+
+template<>
+Uint transcodeAscii(const Char16* input, const Uint length, Char8* output, const Uint outputSize);
+
+template<typename Input, typename Output>
+static Uint transcodedLength(const Input* input, const Uint length);
+
+
+// Core::Unicode
+
+Uint Unicode::toUtf8(const Char16* string, const Uint length, Char8* output, const Uint outputSize)
+{
+	return ::transcode(string, length, output, outputSize);
+}
+
+Uint Unicode::toUtf8(const Char32* string, const Uint length, Char8* output, const Uint outputSize)
+{
+	return ::transcode(string, length, output, outputSize);
+}
+
+Uint Unicode::toUtf8Length(const Char16* string, const Uint length)
+{
+	return ::transcodedLength<Char16, Char8>(string, length);
+}
+
+Uint Unicode::toUtf8Length(const Char32* string, const Uint length)
+{
+	return ::transcodedLength<Char32, Char8>(string, length);
+}
+
+Uint Unicode::toUtf16(const Char8* string, const Uint length, Char16* output, const Uint outputSize)
+{
+	return ::transcode(string, length, output, outputSize);
+}
+
+Uint Unicode::toUtf16(const Char32* string, const Uint length, Char16* output, const Uint outputSize)
+{
+	return ::transcode(string, length, output, outputSize);
+}
+
+Uint Unicode::toUtf16Length(const Char8* string, const Uint length)
+{
+	return ::transcodedLength<Char8, Char16>(string, length);
+}
+
+Uint Unicode::toUtf16Length(const Char32* string, const Uint length)
+{
+	return ::transcodedLength<Char32, Char16>(string, length);
+}
+
+Uint Unicode::toUtf32(const Char8* string, const Uint length, Char32* output, const Uint outputSize)
+{
+	return ::transcode(string, length, output, outputSize);
+}
+
+Uint Unicode::toUtf32(const Char16* string, const Uint length, Char32* output, const Uint outputSize)
+{
+	return ::transcode(string, length, output, outputSize);
+}
+
+Uint Unicode::toUtf32Length(const Char8* string, const Uint length)
+{
+	return ::transcodedLength<Char8, Char32>(string, length);
+}
+
+Uint Unicode::toUtf32Length(const Char16* string, const Uint length)
+{
+	return ::transcodedLength<Char16, Char32>(string, length);
+}
+
+
+// External
+
+static Bool decode(const Char8*& input, const Char8* inputEnd, Char32& codePoint)
+{
+	const Uint8 leadByte = static_cast<Uint8>(input[0]);
+	Uint sequenceLength;
+	Uint8 minimumSecondByte = 0x80u;
+	Uint8 maximumSecondByte = 0xBFu;
+
+	// The ranges of the second byte exclude overlong encodings, surrogates
+	// and code points above U+10FFFF
+
+	if(leadByte < 0x80u)
+	{
+		codePoint = leadByte;
+		++input;
+
+		return true;
+	}
+	else if(leadByte >= 0xC2u && leadByte <= 0xDFu)
+	{
+		sequenceLength = 2u;
+		codePoint = leadByte & 0x1Fu;
+	}
+	else if(leadByte >= 0xE0u && leadByte <= 0xEFu)
+	{
+		sequenceLength = 3u;
+		codePoint = leadByte & 0x0Fu;
+
+		if(leadByte == 0xE0u)
+			minimumSecondByte = 0xA0u;
+		else if(leadByte == 0xEDu)
+			maximumSecondByte = 0x9Fu;
+	}
+	else if(leadByte >= 0xF0u && leadByte <= 0xF4u)
+	{
+		sequenceLength = 4u;
+		codePoint = leadByte & 0x07u;
+
+		if(leadByte == 0xF0u)
+			minimumSecondByte = 0x90u;
+		else if(leadByte == 0xF4u)
+			maximumSecondByte = 0x8Fu;
+	}
+	else
+	{
+		return false;
+	}
+
+	if(static_cast<Uint>(inputEnd - input) < sequenceLength)
+		return false;
+
+	const Uint8 secondByte = static_cast<Uint8>(input[1]);
+
+	if(secondByte < minimumSecondByte || secondByte > maximumSecondByte)
+		return false;
+
+	codePoint = (codePoint << 6u) | (secondByte & 0x3Fu);
+
+	for(Uint i = 2u; i < sequenceLength; ++i)
+	{
+		if(!::isContinuationByte(input[i]))
+			return false;
+
+		codePoint = (codePoint << 6u) | (static_cast<Uint8>(input[i]) & 0x3Fu);
+	}
+
+	input += sequenceLength;
+	return true;
+}
+
+static Bool decode(const Char16*& input, const Char16* inputEnd, Char32& codePoint)
+{
+	const Char32 unit = input[0];
+
+	if(!::isSurrogate(unit))
+	{
+		codePoint = unit;
+		++input;
+
+		return true;
+	}
+
+	// A high surrogate must be followed by a low surrogate
+
+	if(unit >= 0xDC00u || inputEnd - input < 2)
+		return false;
+
+	const Char32 lowUnit = input[1];
+
+	if(lowUnit < 0xDC00u || lowUnit > 0xDFFFu)
+		return false;
+
+	codePoint = 0x10000u + ((unit - 0xD800u) << 10u) + (lowUnit - 0xDC00u);
+	input += 2;
+
+	return true;
+}
+
+static Bool decode(const Char32*& input, const Char32*, Char32& codePoint)
+{
+	codePoint = input[0];
+	++input;
+
+	return codePoint <= ::MAX_CODE_POINT && !::isSurrogate(codePoint);
+}
+
+static Uint encode(const Char32 codePoint, Char8* output)
+{
+	if(codePoint < 0x80u)
+	{
+		output[0] = static_cast<Char8>(codePoint);
+		return 1u;
+	}
+	else if(codePoint < 0x800u)
+	{
+		output[0] = static_cast<Char8>(0xC0u | (codePoint >> 6u));
+		output[1] = static_cast<Char8>(0x80u | (codePoint & 0x3Fu));
+
+		return 2u;
+	}
+	else if(codePoint < 0x10000u)
+	{
+		output[0] = static_cast<Char8>(0xE0u | (codePoint >> 12u));
+		output[1] = static_cast<Char8>(0x80u | ((codePoint >> 6u) & 0x3Fu));
+		output[2] = static_cast<Char8>(0x80u | (codePoint & 0x3Fu));
+
+		return 3u;
+	}
+
+	output[0] = static_cast<Char8>(0xF0u | (codePoint >> 18u));
+	output[1] = static_cast<Char8>(0x80u | ((codePoint >> 12u) & 0x3Fu));
+	output[2] = static_cast<Char8>(0x80u | ((codePoint >> 6u) & 0x3Fu));
+	output[3] = static_cast<Char8>(0x80u | (codePoint & 0x3Fu));
+
+	return 4u;
+}
+
+static Uint encode(const Char32 codePoint, Char16* output)
+{
+	if(codePoint < 0x10000u)
+	{
+		output[0] = static_cast<Char16>(codePoint);
+		return 1u;
+	}
+
+	const Char32 offsetCodePoint = codePoint - 0x10000u;
+	output[0] = static_cast<Char16>(0xD800u + (offsetCodePoint >> 10u));
+	output[1] = static_cast<Char16>(0xDC00u + (offsetCodePoint & 0x3FFu));
+
+	return 2u;
+}
+
+static Uint encode(const Char32 codePoint, Char32* output)
+{
+	output[0] = codePoint;
+	return 1u;
+}
+
+static Uint encodedLength(const Char32 codePoint, const Char8*)
+{
+	if(codePoint < 0x80u)
+		return 1u;
+	else if(codePoint < 0x800u)
+		return 2u;
+	else if(codePoint < 0x10000u)
+		return 3u;
+
+	return 4u;
+}
+
+static Uint encodedLength(const Char32 codePoint, const Char16*)
+{
+	return codePoint < 0x10000u ? 1u : 2u;
+}
+
+static Uint encodedLength(const Char32, const Char32*)
+{
+	return 1u;
+}
+
+static Bool isContinuationByte(const Char8 character)
+{
+	return (static_cast<Uint8>(character) & 0xC0u) == 0x80u;
+}
+
+static Bool isSurrogate(const Char32 codePoint)
+{
+	return codePoint >= 0xD800u && codePoint <= 0xDFFFu;
+}
+
+template<typename Input>
+static Uint countAscii(const Input*, const Uint)
+{
+	return 0u;
+}
+
+template<>
+Uint countAscii(const Char8* input, const Uint length)
+{
+	const Uint blockLength = length & ~static_cast<Uint>(15u);
+	Uint i = 0u;
+
+	for(; i < blockLength; i += 16u)
+	{
+		if(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))) != 0)
+			break;
+	}
+
+	return i;
+}
+
+template<>
+Uint countAscii(const Char16* input, const Uint length)
+{
+	const Uint blockLength = length & ~static_cast<Uint>(7u);
+	const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<Int16>(0xFF80u));
+	const __m128i zero = _mm_setzero_si128();
+	Uint i = 0u;
+
+	for(; i < blockLength; i += 8u)
+	{
+		const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+		if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, nonAsciiMask), zero)) != 0xFFFF)
+			break;
+	}
+
+	return i;
+}
+
+template<typename Input, typename Output>
+static Uint transcode(const Input* input, const Uint length, Output* output, const Uint outputSize)
+{
+	const Input* inputEnd = input + length;
+	Uint outputLength = 0u;
+
+	while(input != inputEnd)
+	{
+		// The vectorised path is tried only at ASCII characters, so that
+		// non-ASCII text does not pay for failed attempts
+
+		if(static_cast<Char32>(*input) < 0x80u)
+		{
+			const Uint asciiLength = ::transcodeAscii(input, static_cast<Uint>(inputEnd - input),
+				output + outputLength, outputSize - outputLength);
+
+			input += asciiLength;
+			outputLength += asciiLength;
+
+			if(input == inputEnd)
+				break;
+		}
+
+		Char32 codePoint;
+
+		if(!::decode(input, inputEnd, codePoint))
+			return Unicode::INVALID_LENGTH;
+
+		if(outputSize - outputLength < ::encodedLength(codePoint, output))
+			return Unicode::INVALID_LENGTH;
+
+		outputLength += ::encode(codePoint, output + outputLength);
+	}
+
+	return outputLength;
+}
+
+template<typename Input, typename Output>
+static Uint transcodeAscii(const Input*, const Uint, Output*, const Uint)
+{
+	return 0u;
+}
+
+template<>
+Uint transcodeAscii(const Char8* input, const Uint length, Char16* output, const Uint outputSize)
+{
+	// Widens blocks of 16 ASCII bytes by interleaving them with zero bytes
+
+	const Uint blockLength = (length < outputSize ? length : outputSize) & ~static_cast<Uint>(15u);
+	const __m128i zero = _mm_setzero_si128();
+	Uint i = 0u;
+
+	for(; i < blockLength; i += 16u)
+	{
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+		if(_mm_movemask_epi8(bytes) != 0)
+			break;
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi8(bytes, zero));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8u), _mm_unpackhi_epi8(bytes, zero));
+	}
+
+	return i;
+}
+
+template<>
+Uint transcodeAscii(const Char16* input, const Uint length, Char8* output, const Uint outputSize)
+{
+	// Narrows blocks of 16 ASCII code units by packing them into bytes
+
+	const Uint blockLength = (length < outputSize ? length : outputSize) & ~static_cast<Uint>(15u);
+	const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<Int16>(0xFF80u));
+	const __m128i zero = _mm_setzero_si128();
+	Uint i = 0u;
+
+	for(; i < blockLength; i += 16u)
+	{
+		const __m128i unitsLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+		const __m128i unitsHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8u));
+		const __m128i nonAsciiBits = _mm_and_si128(_mm_or_si128(unitsLow, unitsHigh), nonAsciiMask);
+
+		if(_mm_movemask_epi8(_mm_cmpeq_epi16(nonAsciiBits, zero)) != 0xFFFF)
+			break;
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(unitsLow, unitsHigh));
+	}
+
+	return i;
+}
+
+template<typename Input, typename Output>
+static Uint transcodedLength(const Input* input, const Uint length)
+{
+	const Input* inputEnd = input + length;
+	Uint outputLength = 0u;
+
+	while(input != inputEnd)
+	{
+		// An ASCII character is a single code unit in every encoding
+
+		if(static_cast<Char32>(*input) < 0x80u)
+		{
+			const Uint asciiLength = ::countAscii(input, static_cast<Uint>(inputEnd - input));
+			input += asciiLength;
+			outputLength += asciiLength;
+
+			if(input == inputEnd)
+				break;
+		}
+
+		Char32 codePoint;
+
+		if(!::decode(input, inputEnd, codePoint))
+			return Unicode::INVALID_LENGTH;
+
+		outputLength += ::encodedLength(codePoint, static_cast<const Output*>(nullptr));
+	}
+
+	return outputLength;
+}
@@ -24,6 +24,7 @@
 
 #include <utility>
 #include <core/Log.h>
+#include <core/ScopedLock.h>
 #include <core/debug/Assert.h>
 
 using namespace Core;
@@ -50,14 +51,25 @@ void AllocationTracker::deregisterAllocation(Void* pointer, const Uint size)
 {
 	if(_isInitialised)
 	{
-		AllocationRecordMap::const_iterator iterator = _allocationRecords.find(pointer);
-		DE_ASSERT(iterator != _allocationRecords.end());
+		Bool isFound = false;
+		Uint recordedSize = 0u;
 
-		if(iterator != _allocationRecords.end())
 		{
-			DE_ASSERT(size == 0u || size == iterator->second.size);
-			_allocationRecords.erase(iterator);
+			// A failed assertion logs, which allocates, so the mutex is released before asserting
+
+			ScopedLock<Mutex> lock(_mutex);
+			AllocationRecordMap::const_iterator iterator = _allocationRecords.find(pointer);
+
+			if(iterator != _allocationRecords.end())
+			{
+				isFound = true;
+				recordedSize = iterator->second.size;
+				_allocationRecords.erase(iterator);
+			}
 		}
+
+		DE_ASSERT(isFound);
+		DE_ASSERT(!isFound || size == 0u || size == recordedSize);
 	}
 }
 
@@ -74,10 +86,14 @@ void AllocationTracker::registerAllocation(Void* pointer, const Uint size, const
 	{
 		DE_ASSERT(pointer != nullptr);
 
-		const std::pair<AllocationRecordMap::const_iterator, Bool> result =
-			_allocationRecords.emplace(pointer, AllocationRecord(size, file, line, function));
+		Bool isInserted;
+
+		{
+			ScopedLock<Mutex> lock(_mutex);
+			isInserted = _allocationRecords.emplace(pointer, AllocationRecord(size, file, line, function)).second;
+		}
 
-		DE_ASSERT(result.second);
+		DE_ASSERT(isInserted);
 	}
 }
 
@@ -0,0 +1,64 @@
+/**
+ * @file core/maths/BoundingBox.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Numeric.h>
+#include <core/maths/BoundingBox.h>
+#include <core/maths/Ray.h>
+
+using namespace Core;
+using namespace Maths;
+
+// Public
+
+const BoundingBox BoundingBox::EMPTY = BoundingBox(Vector3(Numeric<Float32>::maximum()),
+	Vector3(-Numeric<Float32>::maximum()));
+
+BoundingBox::BoundingBox(const Vector3& minimum, const Vector3& maximum)
+	: minimum(minimum),
+	  maximum(maximum) { }
+
+Bool BoundingBox::intersects(const Ray& ray, const Float32 maxDistance, Float32& distance) const
+{
+	Float32 entryDistance = 0.0f;
+	Float32 exitDistance = maxDistance;
+
+	for(Uint32 i = 0u; i < 3u; ++i)
+	{
+		const Float32 inverseDirection = ray.inverseDirection()[i];
+		Float32 nearDistance = (minimum[i] - ray.origin[i]) * inverseDirection;
+		Float32 farDistance = (maximum[i] - ray.origin[i]) * inverseDirection;
+
+		if(nearDistance > farDistance)
+		{
+			const Float32 temporary = nearDistance;
+			nearDistance = farDistance;
+			farDistance = temporary;
+		}
+
+		entryDistance = Maths::maximum(entryDistance, nearDistance);
+		exitDistance = Maths::minimum(exitDistance, farDistance);
+
+		if(entryDistance > exitDistance)
+			return false;
+	}
+
+	distance = entryDistance;
+	return true;
+}
@@ -0,0 +1,517 @@
+/**
+ * @file core/maths/BoundingVolumeHierarchy.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <core/Array.h>
+#include <core/Memory.h>
+#include <core/Thread.h>
+#include <core/maths/BoundingVolumeHierarchy.h>
+#include <core/maths/Frustum.h>
+#include <core/maths/Ray.h>
+
+using namespace Core;
+using namespace Maths;
+
+// External
+
+static const Uint32 BIN_COUNT            = 12u;
+static const Uint32 MAX_LEAF_OBJECTS     = 4u;
+static const Uint32 MAX_SAH_DEPTH        = 48u;
+static const Uint32 MAX_SAH_LEAF_OBJECTS = 16u;
+static const Uint32 TRAVERSAL_STACK_SIZE = 96u;
+
+
+// Implementation
+
+class BoundingVolumeHierarchy::Builder final
+{
+public:
+
+	Builder(const BoundingBox* boundingBoxes, ObjectIndexList& objectIndices)
+		: _boundingBoxes(boundingBoxes),
+		  _objectIndices(objectIndices)
+	{
+		const Uint32 objectCount = static_cast<Uint32>(objectIndices.size());
+		_centroids.reserve(objectCount);
+
+		for(Uint32 i = 0u; i < objectCount; ++i)
+			_centroids.push_back(boundingBoxes[i].centre());
+	}
+
+	Builder(const Builder& builder) = delete;
+	Builder(Builder&& builder) = delete;
+
+	~Builder() = default;
+
+	void build(NodeList& nodes, const Uint32 nodeIndex, const Uint32 begin, const Uint32 end,
+		const Uint32 depth) const
+	{
+		Uint32 middle;
+
+		if(split(nodes, nodeIndex, begin, end, depth, middle))
+		{
+			const Uint32 leftIndex = nodes[nodeIndex].offset;
+			build(nodes, leftIndex, begin, middle, depth + 1u);
+			build(nodes, leftIndex + 1u, middle, end, depth + 1u);
+		}
+	}
+
+	/**
+	 * Computes the bounds of the node and either turns it into a leaf or
+	 * partitions its objects between two new child nodes.
+	 *
+	 * @return
+	 *   True if the node was split
+	 */
+	Bool split(NodeList& nodes, const Uint32 nodeIndex, const Uint32 begin, const Uint32 end,
+		const Uint32 depth, Uint32& middle) const
+	{
+		BoundingBox boundingBox = BoundingBox::EMPTY;
+		BoundingBox centroidBounds = BoundingBox::EMPTY;
+
+		for(Uint32 i = begin; i < end; ++i)
+		{
+			const Uint32 objectIndex = _objectIndices[i];
+			boundingBox.include(_boundingBoxes[objectIndex]);
+			centroidBounds.include(_centroids[objectIndex]);
+		}
+
+		Node& node = nodes[nodeIndex];
+		node.boundingBox = boundingBox;
+		const Uint32 objectCount = end - begin;
+
+		if(objectCount <= ::MAX_LEAF_OBJECTS)
+		{
+			makeLeaf(node, begin, objectCount);
+			return false;
+		}
+
+		if(depth < ::MAX_SAH_DEPTH)
+			middle = partitionSAH(boundingBox, centroidBounds, begin, end);
+		else
+			middle = begin;
+
+		if(middle == begin || middle == end)
+		{
+			if(middle == end && objectCount <= ::MAX_SAH_LEAF_OBJECTS)
+			{
+				makeLeaf(node, begin, objectCount);
+				return false;
+			}
+
+			middle = partitionMedian(centroidBounds, begin, end);
+		}
+
+		node.offset = static_cast<Uint32>(nodes.size());
+		node.objectCount = 0u;
+		nodes.resize(nodes.size() + 2u);
+		return true;
+	}
+
+	Builder& operator =(const Builder& builder) = delete;
+	Builder& operator =(Builder&& builder) = delete;
+
+private:
+
+	struct Bin
+	{
+		BoundingBox boundingBox;
+		Uint32 objectCount;
+	};
+
+	const BoundingBox* _boundingBoxes;
+	ObjectIndexList& _objectIndices;
+	Vector<Vector3> _centroids;
+
+	Uint32 binIndex(const Vector3& centroid, const BoundingBox& centroidBounds, const Uint32 axis,
+		const Float32 scale) const
+	{
+		const Uint32 index = static_cast<Uint32>((centroid[axis] - centroidBounds.minimum[axis]) * scale);
+		return index < ::BIN_COUNT ? index : ::BIN_COUNT - 1u;
+	}
+
+	/**
+	 * Partitions the objects along the cheapest bin boundary. Returns end if
+	 * keeping the objects in a leaf is cheaper than any split.
+	 */
+	Uint32 partitionSAH(const BoundingBox& boundingBox, const BoundingBox& centroidBounds, const Uint32 begin,
+		const Uint32 end) const
+	{
+		const Vector3 centroidExtents = centroidBounds.extents();
+		const Float32 inverseArea = 1.0f / boundingBox.surfaceArea();
+		Float32 bestCost = static_cast<Float32>(end - begin);
+		Uint32 bestAxis = 0u;
+		Uint32 bestSplit = 0u;
+
+		for(Uint32 axis = 0u; axis < 3u; ++axis)
+		{
+			if(centroidExtents[axis] <= 0.0f)
+				continue;
+
+			const Float32 scale = ::BIN_COUNT / centroidExtents[axis];
+			Array<Bin, ::BIN_COUNT> bins;
+
+			for(Bin& bin : bins)
+			{
+				bin.boundingBox = BoundingBox::EMPTY;
+				bin.objectCount = 0u;
+			}
+
+			for(Uint32 i = begin; i < end; ++i)
+			{
+				const Uint32 objectIndex = _objectIndices[i];
+				Bin& bin = bins[binIndex(_centroids[objectIndex], centroidBounds, axis, scale)];
+				bin.boundingBox.include(_boundingBoxes[objectIndex]);
+				++bin.objectCount;
+			}
+
+			Array<Float32, ::BIN_COUNT - 1u> leftAreas;
+			Array<Uint32, ::BIN_COUNT - 1u> leftCounts;
+			BoundingBox leftBounds = BoundingBox::EMPTY;
+			Uint32 leftCount = 0u;
+
+			for(Uint32 i = 0u; i < ::BIN_COUNT - 1u; ++i)
+			{
+				leftBounds.include(bins[i].boundingBox);
+				leftCount += bins[i].objectCount;
+				leftAreas[i] = leftBounds.surfaceArea();
+				leftCounts[i] = leftCount;
+			}
+
+			BoundingBox rightBounds = BoundingBox::EMPTY;
+			Uint32 rightCount = 0u;
+
+			for(Uint32 i = ::BIN_COUNT - 1u; i > 0u; --i)
+			{
+				rightBounds.include(bins[i].boundingBox);
+				rightCount += bins[i].objectCount;
+
+				if(leftCounts[i - 1u] == 0u || rightCount == 0u)
+					continue;
+
+				const Float32 cost = 1.0f + inverseArea * (leftAreas[i - 1u] * leftCounts[i - 1u] +
+					rightBounds.surfaceArea() * rightCount);
+
+				if(cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestSplit = i;
+				}
+			}
+		}
+
+		if(bestSplit == 0u)
+			return end;
+
+		const Float32 scale = ::BIN_COUNT / centroidExtents[bestAxis];
+
+		Uint32* middle = std::partition(_objectIndices.data() + begin, _objectIndices.data() + end,
+			[&](const Uint32 objectIndex)
+		{
+			return binIndex(_centroids[objectIndex], centroidBounds, bestAxis, scale) < bestSplit;
+		});
+
+		return static_cast<Uint32>(middle - _objectIndices.data());
+	}
+
+	Uint32 partitionMedian(const BoundingBox& centroidBounds, const Uint32 begin, const Uint32 end) const
+	{
+		const Vector3 centroidExtents = centroidBounds.extents();
+		Uint32 axis = 0u;
+
+		if(centroidExtents.y > centroidExtents[axis])
+			axis = 1u;
+
+		if(centroidExtents.z > centroidExtents[axis])
+			axis = 2u;
+
+		const Uint32 middle = begin + (end - begin) / 2u;
+
+		std::nth_element(_objectIndices.data() + begin, _objectIndices.data() + middle,
+			_objectIndices.data() + end, [&](const Uint32 objectIndexA, const Uint32 objectIndexB)
+		{
+			return _centroids[objectIndexA][axis] < _centroids[objectIndexB][axis];
+		});
+
+		return middle;
+	}
+
+	static void makeLeaf(Node& node, const Uint32 begin, const Uint32 objectCount)
+	{
+		node.offset = begin;
+		node.objectCount = objectCount;
+	}
+};
+
+struct BoundingVolumeHierarchy::SubtreeTask
+{
+	const Builder* builder;
+	NodeList nodes;
+	Uint32 nodeIndex;
+	Uint32 begin;
+	Uint32 end;
+	Uint32 depth;
+};
+
+
+// Public
+
+void BoundingVolumeHierarchy::build(const BoundingBox* boundingBoxes, const Uint32 count,
+	const Uint32 threadCount)
+{
+	DE_ASSERT(threadCount > 0u);
+	clear();
+
+	if(count == 0u)
+		return;
+
+	DE_ASSERT(boundingBoxes != nullptr);
+	_objectIndices.resize(count);
+
+	for(Uint32 i = 0u; i < count; ++i)
+		_objectIndices[i] = i;
+
+	const Builder builder(boundingBoxes, _objectIndices);
+	_nodes.reserve(2u * count - 1u);
+	_nodes.resize(1u);
+
+	if(threadCount == 1u)
+	{
+		builder.build(_nodes, 0u, 0u, count, 0u);
+	}
+	else
+	{
+		// The top levels are split sequentially until there is a subtree for
+		// each thread. The subtrees are then built into separate node arrays
+		// and appended to the final one. Splitting a task may turn it into a
+		// leaf instead, which completes it.
+
+		Vector<SubtreeTask> tasks;
+		tasks.reserve(threadCount + 1u);
+		tasks.push_back({ &builder, NodeList(), 0u, 0u, count, 0u });
+
+		while(!tasks.empty() && tasks.size() < threadCount)
+		{
+			Vector<SubtreeTask>::iterator largestTask = std::max_element(tasks.begin(), tasks.end(),
+				[](const SubtreeTask& taskA, const SubtreeTask& taskB)
+			{
+				return taskA.end - taskA.begin < taskB.end - taskB.begin;
+			});
+
+			const SubtreeTask task = std::move(*largestTask);
+			tasks.erase(largestTask);
+			Uint32 middle;
+
+			if(builder.split(_nodes, task.nodeIndex, task.begin, task.end, task.depth, middle))
+			{
+				const Uint32 leftIndex = _nodes[task.nodeIndex].offset;
+				tasks.push_back({ &builder, NodeList(), leftIndex, task.begin, middle, task.depth + 1u });
+				tasks.push_back({ &builder, NodeList(), leftIndex + 1u, middle, task.end, task.depth + 1u });
+			}
+		}
+
+		// The remaining tasks small enough to be leaves are completed here
+		// rather than given a thread
+
+		for(Uint32 i = 0u; i < tasks.size();)
+		{
+			SubtreeTask& task = tasks[i];
+
+			if(task.end - task.begin <= ::MAX_LEAF_OBJECTS)
+			{
+				Uint32 middle;
+				builder.split(_nodes, task.nodeIndex, task.begin, task.end, task.depth, middle);
+				if(i + 1u < tasks.size())
+					task = std::move(tasks.back());
+
+				tasks.pop_back();
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		const Uint32 taskCount = static_cast<Uint32>(tasks.size());
+
+		// Node storage is reserved up front, so the subtree builds do not reallocate
+
+		for(SubtreeTask& task : tasks)
+		{
+			task.nodes.reserve(2u * (task.end - task.begin) - 1u);
+			task.nodes.resize(1u);
+		}
+
+		Thread* threads = nullptr;
+
+		if(taskCount > 1u)
+		{
+			threads = DE_NEW_ARRAY(Thread, taskCount - 1u);
+
+			for(Uint32 i = 1u; i < taskCount; ++i)
+				threads[i - 1u].run(buildSubtree, &tasks[i]);
+		}
+
+		if(taskCount > 0u)
+			buildSubtree(&tasks[0]);
+
+		for(Uint32 i = 1u; i < taskCount; ++i)
+			threads[i - 1u].join();
+
+		DE_DELETE_ARRAY(threads, Thread, taskCount - 1u);
+
+		for(const SubtreeTask& task : tasks)
+		{
+			const Uint32 base = static_cast<Uint32>(_nodes.size());
+			const Uint32 subtreeNodeCount = static_cast<Uint32>(task.nodes.size());
+
+			for(Uint32 i = 0u; i < subtreeNodeCount; ++i)
+			{
+				Node node = task.nodes[i];
+
+				if(node.objectCount == 0u)
+					node.offset = base + node.offset - 1u;
+
+				if(i == 0u)
+					_nodes[task.nodeIndex] = node;
+				else
+					_nodes.push_back(node);
+			}
+		}
+	}
+
+	_objectBoundingBoxes.reserve(count);
+
+	for(Uint32 i = 0u; i < count; ++i)
+		_objectBoundingBoxes.push_back(boundingBoxes[_objectIndices[i]]);
+}
+
+void BoundingVolumeHierarchy::clear()
+{
+	_nodes.clear();
+	_objectIndices.clear();
+	_objectBoundingBoxes.clear();
+}
+
+void BoundingVolumeHierarchy::queryFrustum(const Frustum& frustum, ObjectIndexList& results) const
+{
+	const auto test = [&frustum](const BoundingBox& boundingBox)
+	{
+		return frustum.intersects(boundingBox);
+	};
+
+	query(test, test, results);
+}
+
+void BoundingVolumeHierarchy::queryOverlap(const BoundingBox& boundingBox, ObjectIndexList& results) const
+{
+	const auto test = [&boundingBox](const BoundingBox& nodeBoundingBox)
+	{
+		return boundingBox.intersects(nodeBoundingBox);
+	};
+
+	query(test, test, results);
+}
+
+void BoundingVolumeHierarchy::queryRay(const Ray& ray, const Float32 maxDistance, ObjectIndexList& results) const
+{
+	const auto test = [&ray, maxDistance](const BoundingBox& boundingBox)
+	{
+		Float32 distance;
+		return boundingBox.intersects(ray, maxDistance, distance);
+	};
+
+	query(test, test, results);
+}
+
+void BoundingVolumeHierarchy::refit(const BoundingBox* boundingBoxes)
+{
+	DE_ASSERT(boundingBoxes != nullptr || _nodes.empty());
+	const Uint32 objectCount = static_cast<Uint32>(_objectIndices.size());
+
+	for(Uint32 i = 0u; i < objectCount; ++i)
+		_objectBoundingBoxes[i] = boundingBoxes[_objectIndices[i]];
+
+	for(Uint32 i = static_cast<Uint32>(_nodes.size()); i > 0u; --i)
+	{
+		Node& node = _nodes[i - 1u];
+
+		if(node.objectCount == 0u)
+		{
+			node.boundingBox = BoundingBox::merge(_nodes[node.offset].boundingBox,
+				_nodes[node.offset + 1u].boundingBox);
+		}
+		else
+		{
+			node.boundingBox = _objectBoundingBoxes[node.offset];
+
+			for(Uint32 j = 1u; j < node.objectCount; ++j)
+				node.boundingBox.include(_objectBoundingBoxes[node.offset + j]);
+		}
+	}
+}
+
+
+// Private
+
+template<typename NodeTest, typename ObjectTest>
+void BoundingVolumeHierarchy::query(NodeTest nodeTest, ObjectTest objectTest, ObjectIndexList& results) const
+{
+	if(_nodes.empty())
+		return;
+
+	Array<Uint32, ::TRAVERSAL_STACK_SIZE> stack;
+	Uint32 stackSize = 0u;
+	stack[stackSize++] = 0u;
+
+	while(stackSize > 0u)
+	{
+		const Node& node = _nodes[stack[--stackSize]];
+
+		if(!nodeTest(node.boundingBox))
+			continue;
+
+		if(node.objectCount == 0u)
+		{
+			DE_ASSERT(stackSize + 2u <= ::TRAVERSAL_STACK_SIZE);
+			stack[stackSize++] = node.offset + 1u;
+			stack[stackSize++] = node.offset;
+		}
+		else
+		{
+			for(Uint32 i = node.offset, end = node.offset + node.objectCount; i < end; ++i)
+			{
+				if(objectTest(_objectBoundingBoxes[i]))
+					results.push_back(_objectIndices[i]);
+			}
+		}
+	}
+}
+
+
+// Static
+
+Int32 BoundingVolumeHierarchy::buildSubtree(Void* parameter)
+{
+	SubtreeTask* task = static_cast<SubtreeTask*>(parameter);
+	task->builder->build(task->nodes, 0u, task->begin, task->end, task->depth);
+	return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file core/maths/Frustum.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/maths/BoundingBox.h>
+#include <core/maths/Frustum.h>
+#include <core/maths/Matrix4.h>
+
+using namespace Maths;
+
+// External
+
+static Vector4 getRow(const Matrix4& matrix, const Uint32 index);
+
+
+// Public
+
+Frustum::Frustum(const Matrix4& viewProjectionTransform)
+{
+	const Vector4 row0 = ::getRow(viewProjectionTransform, 0u);
+	const Vector4 row1 = ::getRow(viewProjectionTransform, 1u);
+	const Vector4 row2 = ::getRow(viewProjectionTransform, 2u);
+	const Vector4 row3 = ::getRow(viewProjectionTransform, 3u);
+
+	_planes[0] = row3 + row0;
+	_planes[1] = row3 - row0;
+	_planes[2] = row3 + row1;
+	_planes[3] = row3 - row1;
+	_planes[4] = row3 + row2;
+	_planes[5] = row3 - row2;
+}
+
+Bool Frustum::intersects(const BoundingBox& boundingBox) const
+{
+	for(Uint32 i = 0u; i < 6u; ++i)
+	{
+		const Vector4& plane = _planes[i];
+
+		const Float32 distance =
+			plane.x * (plane.x < 0.0f ? boundingBox.minimum.x : boundingBox.maximum.x) +
+			plane.y * (plane.y < 0.0f ? boundingBox.minimum.y : boundingBox.maximum.y) +
+			plane.z * (plane.z < 0.0f ? boundingBox.minimum.z : boundingBox.maximum.z) + plane.w;
+
+		if(distance < 0.0f)
+			return false;
+	}
+
+	return true;
+}
+
+
+// External
+
+static Vector4 getRow(const Matrix4& matrix, const Uint32 index)
+{
+	return Vector4(matrix[0][index], matrix[1][index], matrix[2][index], matrix[3][index]);
+}
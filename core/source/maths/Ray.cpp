@@ -0,0 +1,55 @@
+/**
+ * @file core/maths/Ray.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Numeric.h>
+#include <core/maths/Ray.h>
+
+using namespace Core;
+using namespace Maths;
+
+// External
+
+static Float32 reciprocal(const Float32 value);
+
+
+// Public
+
+Ray::Ray(const Vector3& origin, const Vector3& direction)
+	: origin(origin)
+{
+	setDirection(direction);
+}
+
+void Ray::setDirection(const Vector3& direction)
+{
+	_direction = direction;
+	_inverseDirection = Vector3(::reciprocal(direction.x), ::reciprocal(direction.y), ::reciprocal(direction.z));
+}
+
+
+// External
+
+static Float32 reciprocal(const Float32 value)
+{
+	if(value == 0.0f)
+		return Numeric<Float32>::maximum();
+
+	return 1.0f / value;
+}
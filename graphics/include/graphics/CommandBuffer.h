@@ -0,0 +1,130 @@
+/**
+ * @file graphics/CommandBuffer.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+#include <core/Vector.h>
+
+namespace Graphics
+{
+	enum class PrimitiveType;
+
+	struct StreamingAllocation;
+
+	class Colour;
+	class Effect;
+	class GraphicsBuffer;
+	class GraphicsDevice;
+	class StreamingBuffer;
+	class VertexBufferState;
+	class Viewport;
+
+	/**
+	 * Records draws and state changes as compact command packets without
+	 * touching the graphics context. A command buffer may be recorded on any
+	 * thread, but a single buffer must not be recorded on several threads at
+	 * once. Recorded commands are executed in order by GraphicsDevice::submit()
+	 * on the thread owning the device.
+	 */
+	class CommandBuffer final
+	{
+	public:
+
+		CommandBuffer();
+
+		CommandBuffer(const CommandBuffer& commandBuffer) = delete;
+		CommandBuffer(CommandBuffer&& commandBuffer) = default;
+
+		~CommandBuffer() = default;
+
+		void bindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex);
+
+		void bindBufferRange(StreamingBuffer* buffer, const Uint32 bindingIndex,
+			const StreamingAllocation& allocation);
+
+		void clear(const Colour& colour);
+
+		inline Uint32 commandCount() const;
+
+		void debindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex);
+
+		void draw(const PrimitiveType& primitiveType, const Uint32 vertexCount, const Uint32 vertexOffset = 0u);
+
+		void drawIndexed(const PrimitiveType& primitiveType, const Uint32 indexCount, const Uint32 indexOffset = 0u);
+
+		void drawIndexedInstanced(const PrimitiveType& primitiveType, const Uint32 indexCount,
+			const Uint32 instanceCount, const Uint32 indexOffset = 0u, const Int32 vertexOffset = 0,
+			const Uint32 instanceOffset = 0u);
+
+		void drawInstanced(const PrimitiveType& primitiveType, const Uint32 vertexCount, const Uint32 instanceCount,
+			const Uint32 vertexOffset = 0u, const Uint32 instanceOffset = 0u);
+
+		inline Bool empty() const;
+
+		void multiDrawIndexedIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer,
+			const Uint32 drawCount, const Uint bufferOffset = 0u);
+
+		void multiDrawIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer, const Uint32 drawCount,
+			const Uint bufferOffset = 0u);
+
+		/**
+		 * Reserves storage for the given number of packet words to avoid
+		 * reallocation while recording.
+		 */
+		void reserve(const Uint size);
+
+		/**
+		 * Removes all recorded commands. The packet storage is retained so the
+		 * buffer can be re-recorded each frame without allocating.
+		 */
+		void reset();
+
+		void setEffect(Effect* effect);
+
+		void setVertexBufferState(VertexBufferState* vertexBufferState);
+
+		void setViewport(const Viewport& viewport);
+
+		CommandBuffer& operator =(const CommandBuffer& commandBuffer) = delete;
+		CommandBuffer& operator =(CommandBuffer&& commandBuffer) = default;
+
+	private:
+
+		friend class GraphicsDevice;
+
+		enum class CommandType : Uint32;
+
+		using PacketStorage = Core::Vector<Uint64>;
+
+		PacketStorage _packets;
+		Uint32 _commandCount;
+
+		void execute(const GraphicsDevice& graphicsDevice) const;
+
+		template<typename T>
+		void record(const CommandType& commandType, const T& command);
+
+		template<typename T>
+		static const Uint64* read(const Uint64* packet, T& command);
+	};
+
+#include "inline/CommandBuffer.inl"
+}
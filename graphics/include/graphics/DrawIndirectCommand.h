@@ -0,0 +1,51 @@
+/**
+ * @file graphics/DrawIndirectCommand.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+
+namespace Graphics
+{
+	/**
+	 * The layout of a draw read from an indirect buffer by
+	 * GraphicsDevice::multiDrawIndirect().
+	 */
+	struct DrawIndirectCommand final
+	{
+		Uint32 vertexCount;
+		Uint32 instanceCount;
+		Uint32 vertexOffset;
+		Uint32 instanceOffset;
+	};
+
+	/**
+	 * The layout of an indexed draw read from an indirect buffer by
+	 * GraphicsDevice::multiDrawIndexedIndirect().
+	 */
+	struct DrawIndexedIndirectCommand final
+	{
+		Uint32 indexCount;
+		Uint32 instanceCount;
+		Uint32 indexOffset;
+		Int32 vertexOffset;
+		Uint32 instanceOffset;
+	};
+}
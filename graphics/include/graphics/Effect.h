@@ -20,13 +20,27 @@
 
 #pragma once
 
+#include <core/Types.h>
+#include <core/Vector.h>
+#include <graphics/EffectUniform.h>
 #include <graphics/GraphicsResource.h>
 
+namespace Maths
+{
+	class Matrix4;
+	class Vector2;
+	class Vector3;
+	class Vector4;
+}
+
 namespace Graphics
 {
 	class EffectCode;
 	class Shader;
 
+	using EffectUniformBlockList = Core::Vector<EffectUniformBlock>;
+	using EffectUniformList = Core::Vector<EffectUniform>;
+
 	class Effect final : public GraphicsResource
 	{
 	public:
@@ -34,8 +48,46 @@ namespace Graphics
 		Effect(const Effect& effect) = delete;
 		Effect(Effect&& effect) = delete;
 
+		/**
+		 * Returns true once the effect has been compiled and linked. Doesn't
+		 * block while the driver is still working on an effect created with
+		 * GraphicsDevice::createEffectAsync().
+		 */
+		Bool isReady() const;
+
+		/**
+		 * Finds an active uniform by name. Returns nullptr if the effect has no
+		 * such uniform or if the compiler removed it as unused.
+		 */
+		const EffectUniform* findUniform(const Core::Name& name) const;
+
+		const EffectUniformBlock* findUniformBlock(const Core::Name& name) const;
+
+		/**
+		 * Sets a uniform of the default block. Samplers are set to the index of
+		 * their texture unit as Int32. Uniforms which are not active are
+		 * ignored.
+		 */
+		void setUniform(const Core::Name& name, const Float32 value) const;
+
+		void setUniform(const Core::Name& name, const Int32 value) const;
+
+		void setUniform(const Core::Name& name, const Maths::Matrix4& value) const;
+
+		void setUniform(const Core::Name& name, const Maths::Vector2& value) const;
+
+		void setUniform(const Core::Name& name, const Maths::Vector3& value) const;
+
+		void setUniform(const Core::Name& name, const Maths::Vector4& value) const;
+
+		void setUniformBlockBinding(const Core::Name& blockName, const Uint32 bindingIndex) const;
+
 		void setUniformBlockBinding(const Uint32 blockIndex, const Uint32 bindingIndex) const;
 
+		const EffectUniformBlockList& uniformBlocks() const;
+
+		const EffectUniformList& uniforms() const;
+
 		Effect& operator =(const Effect& effect) = delete;
 		Effect& operator =(Effect&& effect) = delete;
 
@@ -0,0 +1,74 @@
+/**
+ * @file graphics/EffectUniform.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Name.h>
+#include <core/Types.h>
+
+namespace Graphics
+{
+	enum class UniformType
+	{
+		Float32,
+		Int32,
+		Matrix3,
+		Matrix4,
+		Other,
+		Sampler,
+		Uint32,
+		Vector2,
+		Vector3,
+		Vector4
+	};
+
+	/**
+	 * An active uniform reflected from a linked effect. Uniforms in the
+	 * default block have a location, whereas uniforms in a uniform block have
+	 * the index of the block and their byte offset and strides within it.
+	 * The matrix stride separates the columns of a matrix, or its rows if the
+	 * matrix is row-major. Array uniforms are named without the trailing "[0]".
+	 */
+	struct EffectUniform final
+	{
+		static const Uint32 DEFAULT_BLOCK = 0xFFFFFFFF;
+
+		Core::Name name;
+		UniformType type;
+		Int32 location;
+		Uint32 blockIndex;
+		Uint32 offset;
+		Uint32 arraySize;
+		Uint32 arrayStride;
+		Uint32 matrixStride;
+		Bool isRowMajor;
+	};
+
+	/**
+	 * An active uniform block reflected from a linked effect. The size is the
+	 * number of bytes a buffer bound to the block must at least provide.
+	 */
+	struct EffectUniformBlock final
+	{
+		Core::Name name;
+		Uint32 index;
+		Uint32 size;
+	};
+}
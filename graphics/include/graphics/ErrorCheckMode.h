@@ -0,0 +1,43 @@
+/**
+ * @file graphics/ErrorCheckMode.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace Graphics
+{
+	/**
+	 * Selects how graphics API errors are detected in development builds.
+	 * Production builds do not check for errors.
+	 *
+	 * Callback: the driver reports errors and warnings asynchronously through
+	 *   a debug callback. Falls back to Strict if debug output is unavailable.
+	 * Off: errors are not checked.
+	 * Sampled: errors are polled after every 64th call, so a reported
+	 *   location may follow the failing call.
+	 * Strict: errors are polled after each call.
+	 */
+	enum class ErrorCheckMode
+	{
+		Callback,
+		Off,
+		Sampled,
+		Strict
+	};
+}
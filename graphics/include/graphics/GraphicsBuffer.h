@@ -28,6 +28,7 @@ namespace Graphics
 	enum class AccessMode;
 	enum class BufferBinding;
 	enum class BufferUsage;
+	enum class MapMode;
 
 	class GraphicsBuffer final : public GraphicsResource
 	{
@@ -38,10 +39,18 @@ namespace Graphics
 
 		void demapData() const;
 
+		/**
+		 * Flushes a subrange of a range mapped with MapMode::ExplicitFlush.
+		 * The offset is relative to the start of the mapped range.
+		 */
+		void flushMappedRange(const Uint size, const Uint offset = 0u) const;
+
 		Uint8* mapData() const;
 
 		Uint8* mapData(const Uint size, const Uint offset = 0u) const;
 
+		Uint8* mapData(const Uint size, const Uint offset, const MapMode& mapMode) const;
+
 		GraphicsBuffer& operator =(const GraphicsBuffer& graphicsBuffer) = delete;
 		GraphicsBuffer& operator =(GraphicsBuffer&& graphicsBuffer) = delete;
 
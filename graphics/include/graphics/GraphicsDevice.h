@@ -34,17 +34,24 @@ namespace Graphics
 	enum class AccessMode;
 	enum class BufferBinding;
 	enum class BufferUsage;
+	enum class ErrorCheckMode;
 	enum class IndexType;
 	enum class PrimitiveType;
 	enum class ShaderType;
 
+	struct StateStatistics;
+	struct StreamingAllocation;
+
 	class Colour;
+	class CommandBuffer;
 	class Effect;
 	class EffectCode;
 	class GraphicsBuffer;
 	class GraphicsResource;
 	class IndexBuffer;
+	class Profiler;
 	class Shader;
+	class StreamingBuffer;
 	class VertexBufferState;
 	class Viewport;
 
@@ -57,6 +64,9 @@ namespace Graphics
 
 		void bindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex) const;
 
+		void bindBufferRange(StreamingBuffer* buffer, const Uint32 bindingIndex,
+			const StreamingAllocation& allocation) const;
+
 		void clear(const Colour& colour) const;
 
 		GraphicsBuffer* createBuffer(const BufferBinding& binding, const Uint size,
@@ -64,9 +74,28 @@ namespace Graphics
 
 		Effect* createEffect(EffectCode* effectCode);
 
+		/**
+		 * Creates an effect without waiting for its shaders to be compiled and
+		 * linked. Effect::isReady() polls the progress; using the effect before
+		 * it is ready blocks until the driver has finished.
+		 */
+		Effect* createEffectAsync(EffectCode* effectCode);
+
 		IndexBuffer* createIndexBuffer(const Uint size, const IndexType& indexType,
 			const AccessMode& accessMode, const BufferUsage& usage);
 
+		/**
+		 * Creates a profiler measuring the CPU and GPU time of named scopes of
+		 * the frames rendered with this device.
+		 */
+		Profiler* createProfiler();
+
+		/**
+		 * Creates a persistently mapped ring buffer providing the given number
+		 * of bytes per frame.
+		 */
+		StreamingBuffer* createStreamingBuffer(const BufferBinding& binding, const Uint frameSize);
+
 		VertexBufferState* createVertexBufferState();
 
 		void debindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex) const;
@@ -79,12 +108,62 @@ namespace Graphics
 		void drawIndexed(const PrimitiveType& primitiveType, const Uint32 indexCount,
 			const Uint32 indexOffset = 0u) const;
 
+		/**
+		 * Draws the indices the given number of times. The vertex offset is added
+		 * to each index, and the instance offset to the instance index read by
+		 * per-instance vertex elements. A non-zero instance offset requires
+		 * OpenGL 4.2.
+		 */
+		void drawIndexedInstanced(const PrimitiveType& primitiveType, const Uint32 indexCount,
+			const Uint32 instanceCount, const Uint32 indexOffset = 0u, const Int32 vertexOffset = 0,
+			const Uint32 instanceOffset = 0u) const;
+
+		/**
+		 * Draws the vertices the given number of times. A non-zero instance
+		 * offset requires OpenGL 4.2.
+		 */
+		void drawInstanced(const PrimitiveType& primitiveType, const Uint32 vertexCount, const Uint32 instanceCount,
+			const Uint32 vertexOffset = 0u, const Uint32 instanceOffset = 0u) const;
+
+		/**
+		 * Issues the given number of tightly packed DrawIndexedIndirectCommands
+		 * read from the indirect buffer, starting at the given byte offset.
+		 * Requires OpenGL 4.0, and OpenGL 4.3 to issue them in a single call.
+		 */
+		void multiDrawIndexedIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer,
+			const Uint32 drawCount, const Uint bufferOffset = 0u) const;
+
+		/**
+		 * Issues the given number of tightly packed DrawIndirectCommands read
+		 * from the indirect buffer, starting at the given byte offset. Requires
+		 * OpenGL 4.0, and OpenGL 4.3 to issue them in a single call.
+		 */
+		void multiDrawIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer, const Uint32 drawCount,
+			const Uint bufferOffset = 0u) const;
+
 		void setEffect(Effect* effect) const;
 
+		/**
+		 * Switches how graphics API errors are detected in development builds.
+		 * Defaults to ErrorCheckMode::Callback.
+		 */
+		void setErrorCheckMode(const ErrorCheckMode& errorCheckMode) const;
+
 		void setVertexBufferState(VertexBufferState* vertexBufferState) const;
 
 		void setViewport(const Viewport& viewport) const;
 
+		/**
+		 * Executes the commands recorded into the given command buffer in
+		 * recording order. Must be called on the thread owning the device.
+		 */
+		void submit(const CommandBuffer& commandBuffer) const;
+
+		/**
+		 * Returns the state-setting call counts of the last presented frame.
+		 */
+		const StateStatistics& stateStatistics() const;
+
 		void swapBuffers() const;
 
 		const Viewport& viewport() const;
@@ -29,6 +29,7 @@
  * enum class BufferBinding
  * {
  *   Index,
+ *   Indirect,
  *   Uniform,
  *   Vertex
  * };
@@ -28,6 +28,7 @@ namespace Graphics
 	enum class AccessMode;
 	enum class BufferUsage;
 	enum class IndexType;
+	enum class MapMode;
 
 	class IndexBuffer final : public GraphicsResource
 	{
@@ -38,12 +39,20 @@ namespace Graphics
 
 		void demapData() const;
 
+		/**
+		 * Flushes a subrange of a range mapped with MapMode::ExplicitFlush.
+		 * The offset is relative to the start of the mapped range.
+		 */
+		void flushMappedRange(const Uint size, const Uint offset = 0u) const;
+
 		inline IndexType indexType() const;
 
 		Uint8* mapData() const;
 
 		Uint8* mapData(const Uint size, const Uint offset = 0u) const;
 
+		Uint8* mapData(const Uint size, const Uint offset, const MapMode& mapMode) const;
+
 		IndexBuffer& operator =(const IndexBuffer& indexBuffer) = delete;
 		IndexBuffer& operator =(IndexBuffer&& indexBuffer) = delete;
 
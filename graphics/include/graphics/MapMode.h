@@ -0,0 +1,56 @@
+/**
+ * @file graphics/MapMode.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+
+namespace Graphics
+{
+	/**
+	 * Modifies how a buffer range is mapped. Invalidation lets the contents of
+	 * the range or the whole buffer be discarded instead of waiting for the
+	 * graphics device to stop using them, and unsynchronised mapping skips
+	 * the wait altogether, leaving synchronisation to the caller. With
+	 * explicit flushing, only the subranges passed to flushMappedRange() are
+	 * guaranteed to be written when the buffer is demapped.
+	 *
+	 * All the modes require write access, and a buffer with read access
+	 * cannot be mapped invalidated or unsynchronised.
+	 */
+	enum class MapMode
+	{
+		Default			 = 0,
+		ExplicitFlush	 = 1,
+		InvalidateBuffer = 2,
+		InvalidateRange	 = 4,
+		Unsynchronised	 = 8
+	};
+
+	inline MapMode operator &(MapMode mapModeA, const MapMode& mapModeB);
+
+	inline MapMode& operator &=(MapMode& mapModeA, const MapMode& mapModeB);
+
+	inline MapMode operator |(MapMode mapModeA, const MapMode& mapModeB);
+
+	inline MapMode& operator |=(MapMode& mapModeA, const MapMode& mapModeB);
+
+#include "inline/MapMode.inl"
+}
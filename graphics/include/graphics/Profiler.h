@@ -0,0 +1,141 @@
+/**
+ * @file graphics/Profiler.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Name.h>
+#include <core/String.h>
+#include <core/Types.h>
+#include <core/Vector.h>
+#include <graphics/GraphicsResource.h>
+
+namespace Graphics
+{
+	/**
+	 * Rolling statistics of a profiled scope over its latest samples, each
+	 * sample being one execution of the scope. Times are in milliseconds.
+	 * There are fewer GPU samples than CPU samples if GPU timing is not
+	 * supported or if frames were dropped before their GPU times arrived.
+	 */
+	struct ProfileStatistics final
+	{
+		Core::Name name;
+		Uint32 depth;
+		Uint32 cpuSampleCount;
+		Uint32 gpuSampleCount;
+		Float64 averageCpuTime;
+		Float64 averageGpuTime;
+		Float64 maximumCpuTime;
+		Float64 maximumGpuTime;
+	};
+
+	using ProfileStatisticsList = Core::Vector<ProfileStatistics>;
+
+	/**
+	 * Measures the CPU and GPU time of nested named scopes. The GPU time is
+	 * measured with timestamp queries, which are read back a few frames later
+	 * without waiting for the graphics device. Frames whose GPU times have not
+	 * arrived within FRAME_COUNT frames are dropped rather than waited for.
+	 *
+	 * Scopes must be closed in reverse order of opening and before
+	 * endFrame(). Must be used on the thread owning the graphics device.
+	 */
+	class Profiler final : public GraphicsResource
+	{
+	public:
+
+		static const Uint32 FRAME_COUNT = 4u;
+		static const Uint32 SAMPLE_COUNT = 64u;
+
+		Profiler(const Profiler& profiler) = delete;
+		Profiler(Profiler&& profiler) = delete;
+
+		void beginScope(const Core::Name& name) const;
+
+		/**
+		 * Returns the number of frames whose GPU times were dropped.
+		 */
+		Uint32 droppedFrameCount() const;
+
+		/**
+		 * Marks the end of the frame and reads back the GPU times of the
+		 * earlier frames that are available. Call once per frame after
+		 * GraphicsDevice::swapBuffers().
+		 */
+		void endFrame() const;
+
+		void endScope() const;
+
+		/**
+		 * Writes the recently measured scopes to a JSON file in the Chrome
+		 * trace event format, which chrome://tracing and Perfetto can open.
+		 * CPU and GPU times are shown as separate threads.
+		 */
+		void exportChromeTrace(const Core::String8& filepath) const;
+
+		const ProfileStatistics* findStatistics(const Core::Name& name) const;
+
+		/**
+		 * Returns false if the graphics device provides no timestamp queries,
+		 * in which case only CPU time is measured.
+		 */
+		Bool hasGpuTiming() const;
+
+		const ProfileStatisticsList& statistics() const;
+
+		Profiler& operator =(const Profiler& profiler) = delete;
+		Profiler& operator =(Profiler&& profiler) = delete;
+
+	private:
+
+		friend class GraphicsDevice;
+
+		class Implementation;
+
+		Implementation* _implementation;
+
+		explicit Profiler(GraphicsInterfaceHandle graphicsInterfaceHandle);
+		~Profiler();
+	};
+
+	/**
+	 * Profiles the enclosing block as a scope.
+	 */
+	class ProfileScope final
+	{
+	public:
+
+		inline ProfileScope(const Profiler* profiler, const Core::Name& name);
+
+		ProfileScope(const ProfileScope& profileScope) = delete;
+		ProfileScope(ProfileScope&& profileScope) = delete;
+
+		inline ~ProfileScope();
+
+		ProfileScope& operator =(const ProfileScope& profileScope) = delete;
+		ProfileScope& operator =(ProfileScope&& profileScope) = delete;
+
+	private:
+
+		const Profiler* _profiler;
+	};
+
+#include "inline/Profiler.inl"
+}
@@ -0,0 +1,140 @@
+/**
+ * @file graphics/RenderQueue.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+#include <core/Vector.h>
+#include <graphics/GraphicsEnumerations.h>
+
+namespace Graphics
+{
+	class CommandBuffer;
+	class Effect;
+	class GraphicsDevice;
+	class VertexBufferState;
+
+	struct DrawItem final
+	{
+		Uint64 sortKey;
+		Effect* effect;
+		VertexBufferState* vertexBufferState;
+		PrimitiveType primitiveType;
+		Uint32 count;
+		Uint32 offset;
+		Bool isIndexed;
+	};
+
+	struct RenderQueueStatistics final
+	{
+		Uint32 drawCount;
+		Uint32 effectChangeCount;
+		Uint32 vertexBufferStateChangeCount;
+
+		// State changes the items would have caused in the order they were added
+
+		Uint32 unsortedEffectChangeCount;
+		Uint32 unsortedVertexBufferStateChangeCount;
+	};
+
+	/**
+	 * Collects draw items for a frame, sorts them by their 64-bit sort keys
+	 * with a radix sort and issues them so that consecutive draws sharing an
+	 * effect or a vertex buffer state do not rebind it.
+	 *
+	 * Sort keys created with createSortKey() order items by layer, then by
+	 * effect, then by vertex buffer state and finally by depth.
+	 */
+	class RenderQueue final
+	{
+	public:
+
+		RenderQueue();
+
+		RenderQueue(const RenderQueue& renderQueue) = delete;
+		RenderQueue(RenderQueue&& renderQueue) = default;
+
+		~RenderQueue() = default;
+
+		void add(const DrawItem& item);
+
+		/**
+		 * Removes all items. Statistics of the last submission are retained.
+		 */
+		void clear();
+
+		inline Bool empty() const;
+
+		/**
+		 * Records the sorted items into the command buffer.
+		 */
+		void record(CommandBuffer& commandBuffer);
+
+		void reserve(const Uint32 itemCount);
+
+		inline Uint32 size() const;
+
+		inline const RenderQueueStatistics& statistics() const;
+
+		/**
+		 * Issues the sorted items immediately. Must be called on the thread
+		 * owning the device.
+		 */
+		void submit(const GraphicsDevice& graphicsDevice);
+
+		RenderQueue& operator =(const RenderQueue& renderQueue) = delete;
+		RenderQueue& operator =(RenderQueue&& renderQueue) = default;
+
+		/**
+		 * Packs the layer into the top 8 bits, the effect key into the next
+		 * 16 bits, the vertex buffer state key into the next 16 bits and the
+		 * low 24 bits of the depth into the remaining bits.
+		 */
+		static inline Uint64 createSortKey(const Uint8 layer, const Uint16 effectKey,
+			const Uint16 vertexBufferStateKey, const Uint32 depth);
+
+	private:
+
+		struct SortEntry final
+		{
+			Uint64 key;
+			Uint32 index;
+		};
+
+		using DrawItemList = Core::Vector<DrawItem>;
+		using SortEntryList = Core::Vector<SortEntry>;
+
+		DrawItemList _items;
+		SortEntryList _sortEntries;
+		SortEntryList _sortBuffer;
+		RenderQueueStatistics _statistics;
+		Effect* _lastAddedEffect;
+		VertexBufferState* _lastAddedVertexBufferState;
+		Uint32 _unsortedEffectChangeCount;
+		Uint32 _unsortedVertexBufferStateChangeCount;
+
+		template<typename T>
+		void issue(T& target);
+
+		void sort();
+	};
+
+#include "inline/RenderQueue.inl"
+}
@@ -0,0 +1,88 @@
+/**
+ * @file graphics/StreamingBuffer.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Types.h>
+#include <graphics/GraphicsResource.h>
+
+namespace Graphics
+{
+	enum class BufferBinding;
+
+	struct StreamingAllocation final
+	{
+		Uint8* data;
+		Uint offset;
+		Uint size;
+	};
+
+	/**
+	 * Ring buffer for data rewritten every frame. The buffer is mapped once
+	 * for its whole lifetime and split into one region per frame in flight.
+	 * Allocations are suballocated linearly from the region of the current
+	 * frame and remain valid until the region is reused, which waits for the
+	 * graphics device to finish the frame that last used it.
+	 *
+	 * Persistent mapping requires OpenGL 4.4. On older versions the
+	 * allocations are staged in system memory and uploaded when they are
+	 * bound, so an allocation must be written before it is bound.
+	 */
+	class StreamingBuffer final : public GraphicsResource
+	{
+	public:
+
+		static const Uint32 FRAME_COUNT = 3u;
+
+		StreamingBuffer(const StreamingBuffer& streamingBuffer) = delete;
+		StreamingBuffer(StreamingBuffer&& streamingBuffer) = delete;
+
+		/**
+		 * Suballocates the given number of bytes from the current frame. The
+		 * offset is aligned as required by the binding.
+		 */
+		StreamingAllocation allocate(const Uint size) const;
+
+		/**
+		 * Marks the end of the frame's use of the buffer and moves to the
+		 * region of the next frame. Call once per frame after submitting the
+		 * draws reading the frame's allocations.
+		 */
+		void endFrame() const;
+
+		Uint frameSize() const;
+
+		StreamingBuffer& operator =(const StreamingBuffer& streamingBuffer) = delete;
+		StreamingBuffer& operator =(StreamingBuffer&& streamingBuffer) = delete;
+
+	private:
+
+		friend class GraphicsDevice;
+
+		class Implementation;
+
+		Implementation* _implementation;
+
+		StreamingBuffer(GraphicsInterfaceHandle graphicsInterfaceHandle, const BufferBinding& binding,
+			const Uint frameSize);
+
+		~StreamingBuffer();
+	};
+}
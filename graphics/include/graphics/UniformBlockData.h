@@ -0,0 +1,90 @@
+/**
+ * @file graphics/UniformBlockData.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Name.h>
+#include <core/Types.h>
+#include <core/Utility.h>
+
+namespace Graphics
+{
+	class Effect;
+	class GraphicsBuffer;
+
+	/**
+	 * CPU staging copy of a uniform block of an effect. Values are written at
+	 * the offsets reflected from the effect, which follow std140 for blocks
+	 * declared with it, so the data can be bound to any effect declaring the
+	 * same std140 block. The block is uploaded only when a write has changed
+	 * it since the previous upload.
+	 */
+	class UniformBlockData final
+	{
+	public:
+
+		UniformBlockData(const Effect* effect, const Core::Name& blockName);
+
+		UniformBlockData(const UniformBlockData& uniformBlockData) = delete;
+		UniformBlockData(UniformBlockData&& uniformBlockData) = delete;
+
+		~UniformBlockData() = default;
+
+		inline const Uint8* data() const;
+
+		inline Bool isDirty() const;
+
+		/**
+		 * Writes a value to a uniform of the block. The value must match the
+		 * std140 representation of the uniform, such as Maths::Vector4 for
+		 * vec4, except for matrices. A matrix is given as tightly packed
+		 * columns, such as Maths::Matrix4 for mat4 or nine floats for mat3, and
+		 * is written with the reflected matrix stride and order. Uniforms which
+		 * are not active are ignored.
+		 */
+		template<typename T>
+		inline void set(const Core::Name& uniformName, const T& value, const Uint32 arrayIndex = 0u);
+
+		void setData(const Core::Name& uniformName, const Void* data, const Uint size,
+			const Uint32 arrayIndex = 0u);
+
+		inline Uint size() const;
+
+		/**
+		 * Copies the block to the start of the buffer if it has changed since
+		 * the previous upload. The buffer must be a uniform buffer with write
+		 * access and room for size() bytes. Returns true if the block was
+		 * copied.
+		 */
+		Bool upload(const GraphicsBuffer* buffer);
+
+		UniformBlockData& operator =(const UniformBlockData& uniformBlockData) = delete;
+		UniformBlockData& operator =(UniformBlockData&& uniformBlockData) = delete;
+
+	private:
+
+		Core::ByteList _data;
+		const Effect* _effect;
+		Uint32 _blockIndex;
+		Bool _isDirty;
+	};
+
+#include "inline/UniformBlockData.inl"
+}
@@ -20,8 +20,8 @@
 
 #pragma once
 
+#include <core/SmallVector.h>
 #include <core/Types.h>
-#include <core/Vector.h>
 #include <graphics/GraphicsResource.h>
 
 namespace Graphics
@@ -31,7 +31,7 @@ namespace Graphics
 	class GraphicsBuffer;
 	class IndexBuffer;
 
-	using VertexElementList = Core::Vector<VertexElement>;
+	using VertexElementList = Core::SmallVector<VertexElement, 8u>;
 
 	class VertexBufferState final : public GraphicsResource
 	{
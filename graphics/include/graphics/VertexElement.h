@@ -26,16 +26,23 @@ namespace Graphics
 {
 	enum class VertexElementType;
 
+	/**
+	 * A divisor of zero advances the element per vertex. Otherwise the element
+	 * advances once per the given number of instances.
+	 */
 	struct VertexElement final
 	{
 		static const Uint32 AFTER_PREVIOUS = 0xFFFFFFFF;
 
+		Uint32 divisor;
 		Uint32 index;
 		Uint32 offset;
 		VertexElementType type;
 
-		VertexElement(const Uint32 index, const VertexElementType& type, const Uint32 offset = AFTER_PREVIOUS)
-			: index(index),
+		VertexElement(const Uint32 index, const VertexElementType& type, const Uint32 offset = AFTER_PREVIOUS,
+			const Uint32 divisor = 0u)
+			: divisor(divisor),
+			  index(index),
 			  offset(offset),
 			  type(type) { }
 	};
@@ -0,0 +1,45 @@
+/**
+ * @file graphics/inline/RenderQueue.inl
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Public
+
+Bool RenderQueue::empty() const
+{
+	return _items.empty();
+}
+
+Uint32 RenderQueue::size() const
+{
+	return static_cast<Uint32>(_items.size());
+}
+
+const RenderQueueStatistics& RenderQueue::statistics() const
+{
+	return _statistics;
+}
+
+// Static
+
+Uint64 RenderQueue::createSortKey(const Uint8 layer, const Uint16 effectKey, const Uint16 vertexBufferStateKey,
+	const Uint32 depth)
+{
+	return static_cast<Uint64>(layer) << 56 | static_cast<Uint64>(effectKey) << 40 |
+		static_cast<Uint64>(vertexBufferStateKey) << 24 | (depth & 0xFFFFFFu);
+}
@@ -0,0 +1,355 @@
+/**
+ * @file graphics/CommandBuffer.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <core/debug/Assert.h>
+#include <graphics/Colour.h>
+#include <graphics/CommandBuffer.h>
+#include <graphics/GraphicsDevice.h>
+#include <graphics/GraphicsEnumerations.h>
+#include <graphics/StreamingBuffer.h>
+#include <graphics/Viewport.h>
+
+using namespace Graphics;
+
+// External
+
+static const Uint PACKET_WORD_SIZE = sizeof(Uint64);
+
+template<typename T>
+static constexpr Uint packetWordCount();
+
+struct BufferIndexedCommand final
+{
+	GraphicsBuffer* buffer;
+	Uint32 bindingIndex;
+};
+
+struct BufferRangeCommand final
+{
+	StreamingBuffer* buffer;
+	StreamingAllocation allocation;
+	Uint32 bindingIndex;
+};
+
+struct DrawCommand final
+{
+	PrimitiveType primitiveType;
+	Uint32 count;
+	Uint32 offset;
+};
+
+struct DrawInstancedCommand final
+{
+	PrimitiveType primitiveType;
+	Uint32 count;
+	Uint32 instanceCount;
+	Uint32 offset;
+	Int32 vertexOffset;
+	Uint32 instanceOffset;
+};
+
+struct MultiDrawIndirectCommand final
+{
+	GraphicsBuffer* buffer;
+	Uint bufferOffset;
+	PrimitiveType primitiveType;
+	Uint32 drawCount;
+};
+
+
+// CommandType
+
+enum class CommandBuffer::CommandType : Uint32
+{
+	BindBufferIndexed,
+	BindBufferRange,
+	Clear,
+	DebindBufferIndexed,
+	Draw,
+	DrawIndexed,
+	DrawIndexedInstanced,
+	DrawInstanced,
+	MultiDrawIndexedIndirect,
+	MultiDrawIndirect,
+	SetEffect,
+	SetVertexBufferState,
+	SetViewport
+};
+
+
+// Public
+
+CommandBuffer::CommandBuffer()
+	: _commandCount(0u) { }
+
+void CommandBuffer::bindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex)
+{
+	DE_ASSERT(buffer != nullptr);
+	record(CommandType::BindBufferIndexed, BufferIndexedCommand{ buffer, bindingIndex });
+}
+
+void CommandBuffer::bindBufferRange(StreamingBuffer* buffer, const Uint32 bindingIndex,
+	const StreamingAllocation& allocation)
+{
+	DE_ASSERT(buffer != nullptr);
+	record(CommandType::BindBufferRange, BufferRangeCommand{ buffer, allocation, bindingIndex });
+}
+
+void CommandBuffer::clear(const Colour& colour)
+{
+	record(CommandType::Clear, colour);
+}
+
+void CommandBuffer::debindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex)
+{
+	DE_ASSERT(buffer != nullptr);
+	record(CommandType::DebindBufferIndexed, BufferIndexedCommand{ buffer, bindingIndex });
+}
+
+void CommandBuffer::draw(const PrimitiveType& primitiveType, const Uint32 vertexCount, const Uint32 vertexOffset)
+{
+	record(CommandType::Draw, DrawCommand{ primitiveType, vertexCount, vertexOffset });
+}
+
+void CommandBuffer::drawIndexed(const PrimitiveType& primitiveType, const Uint32 indexCount,
+	const Uint32 indexOffset)
+{
+	record(CommandType::DrawIndexed, DrawCommand{ primitiveType, indexCount, indexOffset });
+}
+
+void CommandBuffer::drawIndexedInstanced(const PrimitiveType& primitiveType, const Uint32 indexCount,
+	const Uint32 instanceCount, const Uint32 indexOffset, const Int32 vertexOffset, const Uint32 instanceOffset)
+{
+	record(CommandType::DrawIndexedInstanced,
+		DrawInstancedCommand{ primitiveType, indexCount, instanceCount, indexOffset, vertexOffset, instanceOffset });
+}
+
+void CommandBuffer::drawInstanced(const PrimitiveType& primitiveType, const Uint32 vertexCount,
+	const Uint32 instanceCount, const Uint32 vertexOffset, const Uint32 instanceOffset)
+{
+	record(CommandType::DrawInstanced,
+		DrawInstancedCommand{ primitiveType, vertexCount, instanceCount, vertexOffset, 0, instanceOffset });
+}
+
+void CommandBuffer::multiDrawIndexedIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer,
+	const Uint32 drawCount, const Uint bufferOffset)
+{
+	DE_ASSERT(buffer != nullptr);
+
+	record(CommandType::MultiDrawIndexedIndirect,
+		MultiDrawIndirectCommand{ buffer, bufferOffset, primitiveType, drawCount });
+}
+
+void CommandBuffer::multiDrawIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer,
+	const Uint32 drawCount, const Uint bufferOffset)
+{
+	DE_ASSERT(buffer != nullptr);
+	record(CommandType::MultiDrawIndirect, MultiDrawIndirectCommand{ buffer, bufferOffset, primitiveType, drawCount });
+}
+
+void CommandBuffer::reserve(const Uint size)
+{
+	_packets.reserve(size);
+}
+
+void CommandBuffer::reset()
+{
+	_packets.clear();
+	_commandCount = 0u;
+}
+
+void CommandBuffer::setEffect(Effect* effect)
+{
+	DE_ASSERT(effect != nullptr);
+	record(CommandType::SetEffect, effect);
+}
+
+void CommandBuffer::setVertexBufferState(VertexBufferState* vertexBufferState)
+{
+	DE_ASSERT(vertexBufferState != nullptr);
+	record(CommandType::SetVertexBufferState, vertexBufferState);
+}
+
+void CommandBuffer::setViewport(const Viewport& viewport)
+{
+	record(CommandType::SetViewport, viewport.bounds());
+}
+
+// Private
+
+void CommandBuffer::execute(const GraphicsDevice& graphicsDevice) const
+{
+	const Uint64* packet = _packets.data();
+	const Uint64* packetsEnd = packet + _packets.size();
+
+	while(packet != packetsEnd)
+	{
+		const CommandType commandType = static_cast<CommandType>(*packet);
+		++packet;
+
+		switch(commandType)
+		{
+			case CommandType::BindBufferIndexed:
+			{
+				BufferIndexedCommand command;
+				packet = read(packet, command);
+				graphicsDevice.bindBufferIndexed(command.buffer, command.bindingIndex);
+				break;
+			}
+
+			case CommandType::BindBufferRange:
+			{
+				BufferRangeCommand command;
+				packet = read(packet, command);
+				graphicsDevice.bindBufferRange(command.buffer, command.bindingIndex, command.allocation);
+				break;
+			}
+
+			case CommandType::Clear:
+			{
+				Colour colour;
+				packet = read(packet, colour);
+				graphicsDevice.clear(colour);
+				break;
+			}
+
+			case CommandType::DebindBufferIndexed:
+			{
+				BufferIndexedCommand command;
+				packet = read(packet, command);
+				graphicsDevice.debindBufferIndexed(command.buffer, command.bindingIndex);
+				break;
+			}
+
+			case CommandType::Draw:
+			{
+				DrawCommand command;
+				packet = read(packet, command);
+				graphicsDevice.draw(command.primitiveType, command.count, command.offset);
+				break;
+			}
+
+			case CommandType::DrawIndexed:
+			{
+				DrawCommand command;
+				packet = read(packet, command);
+				graphicsDevice.drawIndexed(command.primitiveType, command.count, command.offset);
+				break;
+			}
+
+			case CommandType::DrawIndexedInstanced:
+			{
+				DrawInstancedCommand command;
+				packet = read(packet, command);
+
+				graphicsDevice.drawIndexedInstanced(command.primitiveType, command.count, command.instanceCount,
+					command.offset, command.vertexOffset, command.instanceOffset);
+
+				break;
+			}
+
+			case CommandType::DrawInstanced:
+			{
+				DrawInstancedCommand command;
+				packet = read(packet, command);
+
+				graphicsDevice.drawInstanced(command.primitiveType, command.count, command.instanceCount,
+					command.offset, command.instanceOffset);
+
+				break;
+			}
+
+			case CommandType::MultiDrawIndexedIndirect:
+			{
+				MultiDrawIndirectCommand command;
+				packet = read(packet, command);
+
+				graphicsDevice.multiDrawIndexedIndirect(command.primitiveType, command.buffer, command.drawCount,
+					command.bufferOffset);
+
+				break;
+			}
+
+			case CommandType::MultiDrawIndirect:
+			{
+				MultiDrawIndirectCommand command;
+				packet = read(packet, command);
+
+				graphicsDevice.multiDrawIndirect(command.primitiveType, command.buffer, command.drawCount,
+					command.bufferOffset);
+
+				break;
+			}
+
+			case CommandType::SetEffect:
+			{
+				Effect* effect;
+				packet = read(packet, effect);
+				graphicsDevice.setEffect(effect);
+				break;
+			}
+
+			case CommandType::SetVertexBufferState:
+			{
+				VertexBufferState* vertexBufferState;
+				packet = read(packet, vertexBufferState);
+				graphicsDevice.setVertexBufferState(vertexBufferState);
+				break;
+			}
+
+			case CommandType::SetViewport:
+			{
+				Core::Rectangle bounds;
+				packet = read(packet, bounds);
+				graphicsDevice.setViewport(Viewport(bounds));
+				break;
+			}
+		}
+	}
+}
+
+template<typename T>
+void CommandBuffer::record(const CommandType& commandType, const T& command)
+{
+	const Uint packetIndex = _packets.size();
+	_packets.resize(packetIndex + 1u + ::packetWordCount<T>());
+	_packets[packetIndex] = static_cast<Uint64>(commandType);
+	std::memcpy(&_packets[packetIndex + 1u], &command, sizeof(T));
+	++_commandCount;
+}
+
+// Static
+
+template<typename T>
+const Uint64* CommandBuffer::read(const Uint64* packet, T& command)
+{
+	std::memcpy(&command, packet, sizeof(T));
+	return packet + ::packetWordCount<T>();
+}
+
+
+// External
+
+template<typename T>
+static constexpr Uint packetWordCount()
+{
+	return (sizeof(T) + PACKET_WORD_SIZE - 1u) / PACKET_WORD_SIZE;
+}
@@ -19,6 +19,7 @@
  */
 
 #include <core/Memory.h>
+#include <graphics/CommandBuffer.h>
 #include <graphics/GraphicsDevice.h>
 #include <graphics/GraphicsResource.h>
 
@@ -34,6 +35,11 @@ void GraphicsDevice::destroyResource(GraphicsResource* resource)
 	DE_DELETE(resource, GraphicsResource);
 }
 
+void GraphicsDevice::submit(const CommandBuffer& commandBuffer) const
+{
+	commandBuffer.execute(*this);
+}
+
 // Private
 
 void GraphicsDevice::destroyResources() const
@@ -0,0 +1,186 @@
+/**
+ * @file graphics/RenderQueue.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <utility>
+#include <core/Array.h>
+#include <core/debug/Assert.h>
+#include <graphics/CommandBuffer.h>
+#include <graphics/GraphicsDevice.h>
+#include <graphics/RenderQueue.h>
+
+using namespace Core;
+using namespace Graphics;
+
+// External
+
+static const Uint32 RADIX_BITS = 8u;
+static const Uint32 RADIX_SIZE = 1u << RADIX_BITS;
+static const Uint32 RADIX_MASK = RADIX_SIZE - 1u;
+static const Uint32 PASS_COUNT = 64u / RADIX_BITS;
+
+using Histogram = Array<Uint32, RADIX_SIZE>;
+
+
+// Public
+
+RenderQueue::RenderQueue()
+	: _statistics(),
+	  _lastAddedEffect(nullptr),
+	  _lastAddedVertexBufferState(nullptr),
+	  _unsortedEffectChangeCount(0u),
+	  _unsortedVertexBufferStateChangeCount(0u) { }
+
+void RenderQueue::add(const DrawItem& item)
+{
+	DE_ASSERT(item.effect != nullptr);
+	DE_ASSERT(item.vertexBufferState != nullptr);
+
+	if(item.effect != _lastAddedEffect)
+	{
+		_lastAddedEffect = item.effect;
+		++_unsortedEffectChangeCount;
+	}
+
+	if(item.vertexBufferState != _lastAddedVertexBufferState)
+	{
+		_lastAddedVertexBufferState = item.vertexBufferState;
+		++_unsortedVertexBufferStateChangeCount;
+	}
+
+	_sortEntries.push_back({ item.sortKey, static_cast<Uint32>(_items.size()) });
+	_items.push_back(item);
+}
+
+void RenderQueue::clear()
+{
+	_items.clear();
+	_sortEntries.clear();
+	_lastAddedEffect = nullptr;
+	_lastAddedVertexBufferState = nullptr;
+	_unsortedEffectChangeCount = 0u;
+	_unsortedVertexBufferStateChangeCount = 0u;
+}
+
+void RenderQueue::record(CommandBuffer& commandBuffer)
+{
+	sort();
+	issue(commandBuffer);
+}
+
+void RenderQueue::reserve(const Uint32 itemCount)
+{
+	_items.reserve(itemCount);
+	_sortEntries.reserve(itemCount);
+	_sortBuffer.reserve(itemCount);
+}
+
+void RenderQueue::submit(const GraphicsDevice& graphicsDevice)
+{
+	sort();
+	issue(graphicsDevice);
+}
+
+// Private
+
+template<typename T>
+void RenderQueue::issue(T& target)
+{
+	const Effect* activeEffect = nullptr;
+	const VertexBufferState* activeVertexBufferState = nullptr;
+	_statistics = RenderQueueStatistics();
+
+	for(const SortEntry& entry : _sortEntries)
+	{
+		const DrawItem& item = _items[entry.index];
+
+		if(item.effect != activeEffect)
+		{
+			target.setEffect(item.effect);
+			activeEffect = item.effect;
+			++_statistics.effectChangeCount;
+		}
+
+		if(item.vertexBufferState != activeVertexBufferState)
+		{
+			target.setVertexBufferState(item.vertexBufferState);
+			activeVertexBufferState = item.vertexBufferState;
+			++_statistics.vertexBufferStateChangeCount;
+		}
+
+		if(item.isIndexed)
+			target.drawIndexed(item.primitiveType, item.count, item.offset);
+		else
+			target.draw(item.primitiveType, item.count, item.offset);
+	}
+
+	_statistics.drawCount = static_cast<Uint32>(_sortEntries.size());
+	_statistics.unsortedEffectChangeCount = _unsortedEffectChangeCount;
+	_statistics.unsortedVertexBufferStateChangeCount = _unsortedVertexBufferStateChangeCount;
+}
+
+void RenderQueue::sort()
+{
+	const Uint entryCount = _sortEntries.size();
+	Array<Histogram, PASS_COUNT> histograms;
+
+	for(Histogram& histogram : histograms)
+		histogram.fill(0u);
+
+	for(const SortEntry& entry : _sortEntries)
+	{
+		for(Uint32 i = 0u; i < PASS_COUNT; ++i)
+			++histograms[i][(entry.key >> (i * RADIX_BITS)) & RADIX_MASK];
+	}
+
+	_sortBuffer.resize(entryCount);
+	SortEntry* source = _sortEntries.data();
+	SortEntry* destination = _sortBuffer.data();
+
+	for(Uint32 i = 0u; i < PASS_COUNT; ++i)
+	{
+		Histogram& histogram = histograms[i];
+		const Uint32 shift = i * RADIX_BITS;
+
+		// A digit shared by every key leaves the order unchanged
+
+		if(entryCount == 0u || histogram[(source[0].key >> shift) & RADIX_MASK] == entryCount)
+			continue;
+
+		Uint32 offset = 0u;
+
+		for(Uint32& count : histogram)
+		{
+			const Uint32 digitCount = count;
+			count = offset;
+			offset += digitCount;
+		}
+
+		for(Uint j = 0u; j < entryCount; ++j)
+		{
+			const SortEntry& entry = source[j];
+			destination[histogram[(entry.key >> shift) & RADIX_MASK]++] = entry;
+		}
+
+		std::swap(source, destination);
+	}
+
+	if(source != _sortEntries.data())
+		_sortEntries.swap(_sortBuffer);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file graphics/UniformBlockData.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <core/Error.h>
+#include <core/Log.h>
+#include <core/debug/Assert.h>
+#include <graphics/Effect.h>
+#include <graphics/GraphicsBuffer.h>
+#include <graphics/MapMode.h>
+#include <graphics/UniformBlockData.h>
+
+using namespace Core;
+using namespace Graphics;
+
+// External
+
+static const Char8* COMPONENT_TAG = "[Graphics::UniformBlockData] ";
+
+static Bool copyChangedBytes(const Uint8* source, const Uint size, Uint8* target);
+
+
+// Public
+
+UniformBlockData::UniformBlockData(const Effect* effect, const Name& blockName)
+	: _effect(effect),
+	  _blockIndex(0u),
+	  _isDirty(true)
+{
+	DE_ASSERT(_effect != nullptr);
+	const EffectUniformBlock* block = _effect->findUniformBlock(blockName);
+
+	if(block == nullptr)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to find the active uniform block '" <<
+			blockName.string().data() << "'." << Log::Flush();
+
+		DE_ERROR(0x0);
+	}
+
+	_data.resize(block->size, 0u);
+	_blockIndex = block->index;
+}
+
+void UniformBlockData::setData(const Name& uniformName, const Void* data, const Uint size, const Uint32 arrayIndex)
+{
+	const EffectUniform* uniform = _effect->findUniform(uniformName);
+
+	if(uniform == nullptr)
+		return;
+
+	DE_ASSERT(uniform->blockIndex == _blockIndex);
+	DE_ASSERT(arrayIndex < uniform->arraySize);
+	const Uint offset = uniform->offset + arrayIndex * uniform->arrayStride;
+	const Uint8* bytes = static_cast<const Uint8*>(data);
+
+	if(uniform->type != UniformType::Matrix3 && uniform->type != UniformType::Matrix4)
+	{
+		DE_ASSERT(offset + size <= _data.size());
+
+		// Rewriting the same value doesn't cause an upload
+
+		if(::copyChangedBytes(bytes, size, _data.data() + offset))
+			_isDirty = true;
+
+		return;
+	}
+
+	// The matrix stride may pad the columns, e.g. to 16 bytes for mat3 in
+	// std140, and swaps its role with the element size for row-major matrices
+
+	const Uint dimension = uniform->type == UniformType::Matrix3 ? 3u : 4u;
+	const Uint columnStride = uniform->isRowMajor ? sizeof(Float32) : uniform->matrixStride;
+	const Uint elementStride = uniform->isRowMajor ? uniform->matrixStride : sizeof(Float32);
+	DE_ASSERT(size == dimension * dimension * sizeof(Float32));
+	DE_ASSERT(offset + (dimension - 1u) * (columnStride + elementStride) + sizeof(Float32) <= _data.size());
+
+	for(Uint column = 0u; column < dimension; ++column)
+	{
+		for(Uint row = 0u; row < dimension; ++row)
+		{
+			const Uint8* source = bytes + (column * dimension + row) * sizeof(Float32);
+			Uint8* target = _data.data() + offset + column * columnStride + row * elementStride;
+
+			if(::copyChangedBytes(source, sizeof(Float32), target))
+				_isDirty = true;
+		}
+	}
+}
+
+Bool UniformBlockData::upload(const GraphicsBuffer* buffer)
+{
+	DE_ASSERT(buffer != nullptr);
+
+	if(!_isDirty)
+		return false;
+
+	// The previous contents are orphaned, so the upload doesn't wait for draws still reading them
+
+	Uint8* mappedData = buffer->mapData(_data.size(), 0u, MapMode::InvalidateBuffer);
+	std::copy(_data.begin(), _data.end(), mappedData);
+	buffer->demapData();
+	_isDirty = false;
+
+	return true;
+}
+
+
+// External
+
+static Bool copyChangedBytes(const Uint8* source, const Uint size, Uint8* target)
+{
+	if(std::equal(source, source + size, target))
+		return false;
+
+	std::copy(source, source + size, target);
+	return true;
+}
@@ -42,13 +42,20 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstring>
 #include <core/Array.h>
 #include <core/ConfigInternal.h>
+#include <core/MPSCQueue.h>
 #include <core/Platform.h>
 #include <core/Singleton.h>
+#include <core/String.h>
 #include <core/Types.h>
 #include <core/UtilityMacros.h>
+#include <core/Vector.h>
+#include <graphics/ErrorCheckMode.h>
 #include <graphics/LogUtility.h>
+#include <graphics/StateStatistics.h>
 #include <platform/Version.h>
 
 #if DE_COMPILER == DE_COMPILER_MSVC
@@ -67,6 +74,9 @@
 
 namespace Platform
 {
+	class ProgramBinaryCache;
+	class VertexLayoutCache;
+
 	class OpenGL final : public Core::Singleton<OpenGL>
 	{
 	public:
@@ -1551,6 +1561,10 @@ namespace Platform
 			void (DE_CALL_OPENGL*)(Uint32 vaobj, Uint32 first, Sizei count, const Uint32* buffers,
 				const Intptr* offsets, const Sizei* strides);
 
+		// GL_KHR_parallel_shader_compile
+
+		using MaxShaderCompilerThreadsKHR = void (DE_CALL_OPENGL*)(Uint32 count);
+
 		// Version 1.0
 
 		static BlendFunc blendFunc;
@@ -3618,6 +3632,13 @@ namespace Platform
 		static VertexArrayVertexBuffer vertexArrayVertexBuffer;
 		static VertexArrayVertexBuffers vertexArrayVertexBuffers;
 
+		// GL_KHR_parallel_shader_compile
+
+		static const Uint32 MAX_SHADER_COMPILER_THREADS_KHR = 0x91B0;
+		static const Uint32 COMPLETION_STATUS_KHR			= 0x91B1;
+
+		static MaxShaderCompilerThreadsKHR maxShaderCompilerThreadsKHR;
+
 		static const Core::Array<Version, 7u> SUPPORTED_VERSIONS;
 
 		OpenGL();
@@ -3629,36 +3650,161 @@ namespace Platform
 
 		inline Uint32 bindDefaultVertexArray();
 
+		void bindBufferBaseCustom(const Uint32 binding, const Uint32 bindingIndex, const Uint32 bufferHandle);
+
+		void bindBufferRangeCustom(const Uint32 binding, const Uint32 bindingIndex, const Uint32 bufferHandle,
+			const Uint offset, const Uint size);
+
 		void bindGraphicsBuffer(const Uint32 binding, const Uint32 bufferHandle);
 
 		Uint32 bindVertexArrayCustom(const Uint32 vertexArrayHandle);
 
+		/**
+		 * The delete*Custom() functions delete the object and forget it in the
+		 * state shadow, as the graphics API may reuse its handle.
+		 */
+		void deleteBufferCustom(const Uint32 bufferHandle);
+
+		void deleteProgramCustom(const Uint32 programHandle);
+
+		void deleteVertexArrayCustom(const Uint32 vertexArrayHandle);
+
+		/**
+		 * Returns true if the OpenGL 4.5 direct state access functions are
+		 * available, letting objects be created and edited without binding.
+		 */
+		inline Bool hasDirectStateAccess() const;
+
+		/**
+		 * Returns true if GL_KHR_parallel_shader_compile is available, letting
+		 * compile and link completion be polled without blocking.
+		 */
+		inline Bool hasParallelShaderCompile() const;
+
+		/**
+		 * Returns true if the OpenGL 4.3 vertex attribute binding functions are
+		 * available, letting vertex formats be specified apart from buffers.
+		 */
+		inline Bool hasVertexAttribBinding() const;
+
+		/**
+		 * Logs the messages queued by the debug callback. Must be called on the
+		 * thread owning the context.
+		 */
+		void logDebugMessages();
+
+		inline ProgramBinaryCache& programBinaryCache();
+
+		inline void resetStateStatistics();
+
+		/**
+		 * Switches how errors are detected. Has no effect on the error checks of
+		 * production builds, which are compiled out.
+		 */
+		void setErrorCheckMode(const Graphics::ErrorCheckMode& errorCheckMode);
+
+		inline const Graphics::StateStatistics& stateStatistics() const;
+
+		inline Uint32 uniformBufferOffsetAlignment() const;
+
+		/**
+		 * Returns the handle of the previously used program.
+		 */
+		Uint32 useProgramCustom(const Uint32 programHandle);
+
 		inline Uint32 vertexAttributeCount() const;
 
+		inline VertexLayoutCache& vertexLayoutCache();
+
+		void viewportCustom(const Int32 x, const Int32 y, const Sizei width, const Sizei height);
+
 		OpenGL& operator =(const OpenGL& openGl) = delete;
 		OpenGL& operator =(OpenGL&& openGl) = delete;
 
-		static void checkForErrors(const Char8* file, const Uint32 line, const Char8* function);
+		static inline void checkForErrors(const Char8* file, const Uint32 line, const Char8* function);
 
 	private:
 
-		Core::Array<Uint32, 2u> _activeGraphicsBuffers;
+		// Debug messages are stored in a preallocated ring, as the callback may
+		// be called on a driver thread, which must not allocate nor block
+
+		static const Uint32 DEBUG_MESSAGE_COUNT = 64u;
+
+		static const Uint32 DEBUG_MESSAGE_LENGTH = 256u;
+
+		struct DebugMessage final : public Core::MPSCQueueNode
+		{
+			Core::Array<Char8, DEBUG_MESSAGE_LENGTH> message;
+			std::atomic<Bool> isQueued;
+			Enum severity;
+			Enum source;
+			Enum type;
+			Uint32 id;
+
+			DebugMessage()
+				: isQueued(false) { }
+		};
+
+		static const Uint32 ERROR_CHECK_SAMPLE_INTERVAL = 64u;
+
+		// A size of zero denotes the whole buffer bound with bindBufferBase()
+
+		struct IndexedBufferBinding final
+		{
+			Uint offset;
+			Uint size;
+			Uint32 bufferHandle;
+		};
+
+		Core::Array<DebugMessage, DEBUG_MESSAGE_COUNT> _debugMessagePool;
+		Core::MPSCQueue<DebugMessage> _debugMessages;
+		std::atomic<Uint32> _nextDebugMessageIndex;
+		std::atomic<Uint32> _droppedDebugMessageCount;
+		Core::Array<Uint32, 3u> _activeGraphicsBuffers;
+		Core::Array<Int32, 4u> _activeViewport;
+		Core::Vector<IndexedBufferBinding> _activeUniformBuffers;
 		Version _version;
+		Graphics::StateStatistics _stateStatistics;
 		Uint32 _activeVertexArrayHandle;
+		Uint32 _activeProgramHandle;
 		Uint32 _defaultVertexArrayHandle;
+		Uint32 _uniformBufferOffsetAlignment;
 		Uint32 _vertexAttributeCount;
+		ProgramBinaryCache* _programBinaryCache;
+		VertexLayoutCache* _vertexLayoutCache;
+		Bool _hasDirectStateAccess;
+		Bool _hasParallelShaderCompile;
+		Bool _hasVertexAttribBinding;
 
 		void initialiseVersion();
 		void checkSupport() const;
 		void getStandardFunctions() const;
+		void getExtensionFunctions();
 		void getCapabilities();
 		void logInfo() const;
 		void createDefaultVertexArray();
+		void initialiseState();
+
+		void setIndexedBufferBinding(const Uint32 binding, const Uint32 bindingIndex, const Uint32 bufferHandle,
+			const Uint offset, const Uint size);
+
+		inline void countFilteredCall();
+		inline void countIssuedCall();
+
+		static Graphics::ErrorCheckMode _errorCheckMode;
+		static Uint32 _errorCheckCount;
 
 		static const Char8* getCharacters(const Uint32 name);
 		static const Char8* getCharacters(const Uint32 name, const Uint32 index);
 		static Graphics::ExtensionNameList getExtensionNames();
 		static Int32 getInteger(const Uint32 name);
+
+		static inline void DE_CALL_OPENGL queueDebugMessage(Enum source, Enum type, Uint32 id, Enum severity,
+			Sizei length, const Char8* message, const Void* userParam);
+
+		static void reportErrors(const Char8* file, const Uint32 line, const Char8* function);
+
+		friend class VertexLayout;
 	};
 
 #include "inline/OpenGL.inl"
@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <core/FlatMap.h>
+#include <core/Name.h>
+#include <core/SmallVector.h>
 #include <core/Types.h>
 #include <core/Vector.h>
 #include <graphics/Effect.h>
@@ -37,26 +40,95 @@ namespace Graphics
 
 		~Implementation();
 
-		void attachShader(Shader* shader) const;
+		/**
+		 * Attaches the shader and takes ownership of it. The shader is deleted
+		 * once the program has been linked.
+		 */
+		void attachShader(Shader* shader);
+
+		/**
+		 * Waits for a pending link to finish, checks it and stores the program
+		 * binary. Does nothing if no link is pending.
+		 */
+		void finaliseLink();
+
+		const EffectUniform* findUniform(const Core::Name& name);
+
+		const EffectUniformBlock* findUniformBlock(const Core::Name& name);
 
 		inline Uint32 handle() const;
 
-		void link() const;
+		/**
+		 * Returns true if no link is pending or if the driver reports that the
+		 * pending link has finished. Without parallel shader compilation the
+		 * completion can't be polled and is always reported.
+		 */
+		Bool isLinkComplete() const;
+
+		/**
+		 * Issues the link without waiting for it. The program can't be used
+		 * before finaliseLink() has been called.
+		 */
+		void link(const Uint64 sourceHash);
+
+		/**
+		 * Loads the program from the program binary cache. Returns false if
+		 * the cache has no usable binary, in which case the program has to be
+		 * linked from source.
+		 */
+		Bool loadBinary(const Uint64 sourceHash);
+
+		void setUniform(const Core::Name& name, const Float32 value);
+
+		void setUniform(const Core::Name& name, const Int32 value);
+
+		void setUniform(const Core::Name& name, const Maths::Matrix4& value);
+
+		void setUniform(const Core::Name& name, const Maths::Vector2& value);
+
+		void setUniform(const Core::Name& name, const Maths::Vector3& value);
+
+		void setUniform(const Core::Name& name, const Maths::Vector4& value);
+
+		void setUniformBlockBinding(const Core::Name& blockName, const Uint32 bindingIndex);
 
 		void setUniformBlockBinding(const Uint32 blockIndex, const Uint32 bindingIndex) const;
 
+		inline const EffectUniformBlockList& uniformBlocks();
+
+		inline const EffectUniformList& uniforms();
+
 		Implementation& operator =(const Implementation& implementation) = delete;
 		Implementation& operator =(Implementation&& implementation) = delete;
 
 	private:
 
 		using CharacterBuffer = Core::Vector<Char8>;
-
+		using NameIndexMap = Core::FlatMap<Core::Name, Uint32>;
+		using ParameterList = Core::Vector<Int32>;
+		using ShaderList = Core::SmallVector<Shader*, 2u>;
+		using UniformIndexList = Core::Vector<Uint32>;
+
+		EffectUniformBlockList _uniformBlocks;
+		EffectUniformList _uniforms;
+		NameIndexMap _uniformBlockIndices;
+		NameIndexMap _uniformIndices;
+		ShaderList _pendingShaders;
+		Uint64 _sourceHash;
 		Uint32 _programHandle;
+		Bool _isLinkPending;
 
 		void checkLinkingStatus() const;
+		void deletePendingShaders();
 		void detachShaders() const;
 		Int32 getParameter(const Uint32 parameterName) const;
+		Int32 getUniformLocation(const Core::Name& name);
+
+		ParameterList getUniformParameters(const UniformIndexList& uniformIndices, const Uint32 parameterName) const;
+
+		void reflect();
+		void reflectUniformBlocks();
+		void reflectUniforms();
 		void outputLinkerFailureLog() const;
 		void outputLinkerSuccessLog() const;
 		CharacterBuffer getInfoLog(const Uint32 logLength) const;
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <graphics/GraphicsBuffer.h>
+#include <graphics/MapMode.h>
 #include <platform/opengl/OpenGL.h>
 #include <platform/opengl/OpenGLGraphicsBufferBase.h>
 
@@ -44,9 +45,11 @@ namespace Graphics
 
 		void demapData() const;
 
+		void flushMappedRange(const Uint size, const Uint offset) const;
+
 		inline Uint8* mapData() const;
 
-		Uint8* mapData(const Uint size, const Uint offset) const;
+		Uint8* mapData(const Uint size, const Uint offset, const MapMode& mapMode) const;
 
 		Implementation& operator =(const Implementation& implementation) = delete;
 		Implementation& operator =(Implementation&& implementation) = delete;
@@ -54,6 +57,8 @@ namespace Graphics
 	private:
 
 		using Base = Platform::GraphicsBufferBase;
+
+		inline void bindForEditing() const;
 	};
 
 #include "inline/OpenGLGraphicsBuffer.inl"
@@ -28,6 +28,7 @@ namespace Graphics
 	enum class AccessMode;
 	enum class BufferBinding;
 	enum class BufferUsage;
+	enum class MapMode;
 }
 
 namespace Platform
@@ -50,9 +51,11 @@ namespace Platform
 
 		void demapData() const;
 
+		void flushMappedRange(const Uint size, const Uint offset) const;
+
 		inline Uint32 handle() const;
 
-		Uint8* mapData(const Uint size, const Uint offset) const;
+		Uint8* mapData(const Uint size, const Uint offset, const Graphics::MapMode& mapMode) const;
 
 		GraphicsBufferBase& operator =(const GraphicsBufferBase& graphicsBufferBase) = delete;
 		GraphicsBufferBase& operator =(GraphicsBufferBase&& graphicsBufferBase) = delete;
@@ -74,6 +77,7 @@ namespace Platform
 		void initialiseAccessMode(const Graphics::AccessMode& accessMode);
 		void createBuffer();
 
+		static Uint32 getMapFlags(const Graphics::MapMode& mapMode);
 		static Uint32 getUsageId(const Graphics::AccessMode& accessMode, const Graphics::BufferUsage& usage);
 	};
 
@@ -32,9 +32,10 @@ namespace Graphics
 	 */
 	enum class BufferBinding
 	{
-		Index	= 0x088930,
-		Uniform = 0x08A110,
-		Vertex	= 0x088921
+		Index	 = 0x088930,
+		Indirect = 0x08F3F2,
+		Uniform	 = 0x08A110,
+		Vertex	 = 0x088921
 	};
 
 	/*
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <graphics/IndexBuffer.h>
+#include <graphics/MapMode.h>
 #include <platform/opengl/OpenGLGraphicsBufferBase.h>
 
 namespace Graphics
@@ -43,9 +44,11 @@ namespace Graphics
 
 		void demapData() const;
 
+		void flushMappedRange(const Uint size, const Uint offset) const;
+
 		inline Uint8* mapData() const;
 
-		Uint8* mapData(const Uint size, const Uint offset) const;
+		Uint8* mapData(const Uint size, const Uint offset, const MapMode& mapMode) const;
 
 		Implementation& operator =(const Implementation& implementation) = delete;
 		Implementation& operator =(Implementation&& implementation) = delete;
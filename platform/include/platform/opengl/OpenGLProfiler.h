@@ -0,0 +1,144 @@
+/**
+ * @file platform/opengl/OpenGLProfiler.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Array.h>
+#include <core/FlatMap.h>
+#include <core/Name.h>
+#include <core/String.h>
+#include <core/Types.h>
+#include <core/Vector.h>
+#include <graphics/Profiler.h>
+
+namespace Graphics
+{
+	class Profiler::Implementation final
+	{
+	public:
+
+		Implementation();
+
+		Implementation(const Implementation& implementation) = delete;
+		Implementation(Implementation&& implementation) = delete;
+
+		~Implementation();
+
+		void beginScope(const Core::Name& name);
+
+		inline Uint32 droppedFrameCount() const;
+
+		void endFrame();
+
+		void endScope();
+
+		void exportChromeTrace(const Core::String8& filepath) const;
+
+		const ProfileStatistics* findStatistics(const Core::Name& name) const;
+
+		inline Bool hasGpuTiming() const;
+
+		inline const ProfileStatisticsList& statistics() const;
+
+		Implementation& operator =(const Implementation& implementation) = delete;
+		Implementation& operator =(Implementation&& implementation) = delete;
+
+	private:
+
+		// Times are in nanoseconds since the creation of the profiler
+
+		struct ScopeRecord final
+		{
+			Core::Name name;
+			Int64 cpuBeginTime;
+			Int64 cpuEndTime;
+			Uint32 depth;
+			Uint32 queryIndex;
+		};
+
+		using QueryHandleList = Core::Vector<Uint32>;
+		using ScopeRecordList = Core::Vector<ScopeRecord>;
+
+		// Each scope uses two timestamp queries, the first at queryIndex
+
+		struct Frame final
+		{
+			QueryHandleList queryHandles;
+			ScopeRecordList scopes;
+			Uint32 frameNumber;
+			Uint32 lastQueryIndex;
+			Bool isPending;
+		};
+
+		struct TraceEvent final
+		{
+			Core::Name name;
+			Int64 cpuBeginTime;
+			Int64 cpuEndTime;
+			Int64 gpuBeginTime;
+			Int64 gpuEndTime;
+			Uint32 frameNumber;
+			Bool hasGpuTime;
+		};
+
+		struct SampleWindow final
+		{
+			Core::Array<Float64, SAMPLE_COUNT> times;
+			Uint32 count;
+			Uint32 nextIndex;
+		};
+
+		struct ScopeSamples final
+		{
+			SampleWindow cpuTimes;
+			SampleWindow gpuTimes;
+		};
+
+		static const Uint32 MAX_TRACE_EVENT_COUNT = 65536u;
+
+		Core::Array<Frame, FRAME_COUNT> _frames;
+		Core::Vector<Uint32> _openScopeIndices;
+		Core::Vector<TraceEvent> _traceEvents;
+		Core::Vector<ScopeSamples> _scopeSamples;
+		ProfileStatisticsList _statistics;
+		Core::FlatMap<Core::Name, Uint32> _statisticsIndices;
+		Int64 _cpuEpoch;
+		Int64 _gpuEpoch;
+		Uint32 _frameIndex;
+		Uint32 _frameNumber;
+		Uint32 _droppedFrameCount;
+		Bool _hasGpuTiming;
+
+		void initialiseGpuTiming();
+		Int64 getCpuTime() const;
+		void issueTimestamp(Frame& frame, const Uint32 queryIndex) const;
+		Bool isFrameAvailable(const Frame& frame) const;
+		void resolveFrames();
+		void resolveFrame(Frame& frame, const Bool hasGpuTimes);
+		Int64 getGpuTime(const Frame& frame, const Uint32 queryIndex) const;
+		void addSamples(const ScopeRecord& scope, const Float64 cpuTime, const Float64 gpuTime, const Bool hasGpuTime);
+		void addTraceEvent(const TraceEvent& traceEvent);
+
+		static void addSample(SampleWindow& window, const Float64 time, Uint32& sampleCount, Float64& averageTime,
+			Float64& maximumTime);
+	};
+
+#include "inline/OpenGLProfiler.inl"
+}
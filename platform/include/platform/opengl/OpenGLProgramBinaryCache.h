@@ -0,0 +1,82 @@
+/**
+ * @file platform/opengl/OpenGLProgramBinaryCache.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/String.h>
+#include <core/Types.h>
+
+namespace Platform
+{
+	/**
+	 * Stores linked program binaries on disk, next to the executable, keyed by
+	 * a hash of the shader sources. Each entry records the driver it was
+	 * created with, and an entry from another vendor, renderer or driver
+	 * version is ignored and replaced.
+	 *
+	 * Requires OpenGL 4.1, and a driver supporting at least one binary
+	 * format. Otherwise the cache is disabled and programs are always linked
+	 * from source. The cache is also disabled, with a warning, if the
+	 * directory or an entry cannot be written.
+	 */
+	class ProgramBinaryCache final
+	{
+	public:
+
+		ProgramBinaryCache();
+
+		ProgramBinaryCache(const ProgramBinaryCache& programBinaryCache) = delete;
+		ProgramBinaryCache(ProgramBinaryCache&& programBinaryCache) = delete;
+
+		~ProgramBinaryCache() = default;
+
+		inline Bool isEnabled() const;
+
+		/**
+		 * Loads the cached binary into the program. Returns false if there is no
+		 * entry for the source hash or the driver rejected it, in which case the
+		 * program has to be linked from source.
+		 */
+		Bool load(const Uint32 programHandle, const Uint64 sourceHash) const;
+
+		/**
+		 * Writes the binary of the linked program as the entry for the source
+		 * hash.
+		 */
+		void store(const Uint32 programHandle, const Uint64 sourceHash);
+
+		ProgramBinaryCache& operator =(const ProgramBinaryCache& programBinaryCache) = delete;
+		ProgramBinaryCache& operator =(ProgramBinaryCache&& programBinaryCache) = delete;
+
+	private:
+
+		Core::String8 _directory;
+		Uint64 _driverHash;
+		Bool _isEnabled;
+
+		void disable(const Core::String8& path);
+
+		Core::String8 getFilepath(const Uint64 sourceHash) const;
+
+		static Uint64 getDriverHash();
+	};
+
+#include "inline/OpenGLProgramBinaryCache.inl"
+}
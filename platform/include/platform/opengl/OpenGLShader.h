@@ -37,6 +37,13 @@ namespace Graphics
 
 		~Implementation();
 
+		/**
+		 * Waits for the compilation to finish and fails if it was unsuccessful.
+		 * Compilation is only issued by the constructor so that drivers
+		 * supporting parallel compilation can overlap it with other work.
+		 */
+		void checkCompilationStatus() const;
+
 		inline Uint32 handle() const;
 
 		Implementation& operator =(const Implementation& implementation) = delete;
@@ -50,7 +57,6 @@ namespace Graphics
 
 		void createShader(const ShaderType& type);
 		void compileShader(const Char8* shaderSource) const;
-		void checkCompilationStatus() const;
 		Int32 getParameter(const Uint32 parameterName) const;
 		void outputCompilerFailureLog() const;
 		void outputCompilerSuccessLog() const;
@@ -0,0 +1,74 @@
+/**
+ * @file platform/opengl/OpenGLStreamingBuffer.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/Array.h>
+#include <graphics/StreamingBuffer.h>
+#include <platform/opengl/OpenGL.h>
+#include <platform/opengl/OpenGLGraphicsBufferBase.h>
+
+namespace Graphics
+{
+	class StreamingBuffer::Implementation final : public Platform::GraphicsBufferBase
+	{
+	public:
+
+		Implementation(GraphicsInterfaceHandle graphicsInterfaceHandle, const BufferBinding& binding,
+			const Uint frameSize);
+
+		Implementation(const Implementation& implementation) = delete;
+		Implementation(Implementation&& implementation) = delete;
+
+		~Implementation();
+
+		StreamingAllocation allocate(const Uint size);
+
+		void endFrame();
+
+		inline Uint frameSize() const;
+
+		/**
+		 * Uploads the allocation if the buffer is not persistently mapped.
+		 */
+		void upload(const StreamingAllocation& allocation);
+
+		Implementation& operator =(const Implementation& implementation) = delete;
+		Implementation& operator =(Implementation&& implementation) = delete;
+
+	private:
+
+		using Base = Platform::GraphicsBufferBase;
+		using FenceArray = Core::Array<Platform::OpenGL::Sync, FRAME_COUNT>;
+
+		FenceArray _fences;
+		Uint8* _data;
+		Uint _frameSize;
+		Uint _frameOffset;
+		Uint _alignment;
+		Uint32 _frameIndex;
+		Bool _isPersistent;
+
+		void initialiseStorage();
+		void waitForFence(const Uint32 frameIndex);
+	};
+
+#include "inline/OpenGLStreamingBuffer.inl"
+}
@@ -23,6 +23,11 @@
 #include <graphics/VertexBufferState.h>
 #include <platform/opengl/OpenGL.h>
 
+namespace Platform
+{
+	class VertexLayout;
+}
+
 namespace Graphics
 {
 	class VertexBufferState::Implementation final
@@ -36,16 +41,18 @@ namespace Graphics
 
 		~Implementation();
 
-		inline Uint32 bind() const;
-
-		inline Uint32 debind(const Uint32 previousVertexArrayHandle) const;
+		/**
+		 * Binds the vertex array for drawing. With vertex attribute binding, this
+		 * binds the shared vertex layout and only rebinds the buffers.
+		 */
+		void bind() const;
 
 		inline IndexBuffer* indexBuffer() const;
 
 		void setIndexBuffer(IndexBuffer* buffer);
 
 		void setVertexBuffer(const GraphicsBuffer* buffer, const VertexElementList& vertexElements,
-			const Uint32 stride, const Uint offset) const;
+			const Uint32 stride, const Uint offset);
 
 		Implementation& operator =(const Implementation& implementation) = delete;
 		Implementation& operator =(Implementation&& implementation) = delete;
@@ -54,8 +61,16 @@ namespace Graphics
 
 		IndexBuffer* _indexBuffer;
 		Platform::OpenGL* _openGl;
+		const GraphicsBuffer* _vertexBuffer;
+		Platform::VertexLayout* _vertexLayout;
+		Uint _vertexBufferOffset;
+		Uint32 _vertexBufferStride;
 		Uint32 _vertexArrayHandle;
 
+		inline Uint32 bindForEditing() const;
+
+		inline Uint32 debindForEditing(const Uint32 previousVertexArrayHandle) const;
+
 		void setVertexLayout(const VertexElementList& vertexElements, const Uint32 stride,
 			const Uint bufferOffset) const;
 
@@ -0,0 +1,86 @@
+/**
+ * @file platform/opengl/OpenGLVertexLayout.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/SmallVector.h>
+#include <core/Types.h>
+#include <graphics/VertexBufferState.h>
+
+namespace Graphics
+{
+	enum class VertexElementType;
+}
+
+namespace Platform
+{
+	class OpenGL;
+
+	/**
+	 * Vertex array whose attribute formats are specified once, with the
+	 * vertex data read through a single buffer binding. Vertex buffer states
+	 * sharing a layout share the vertex array, and switching between them
+	 * only rebinds the vertex and index buffers. Elements with different
+	 * divisors read the same buffer through separate bindings. A stride of 0
+	 * means the vertices are tightly packed, as with glVertexAttribPointer.
+	 *
+	 * Requires OpenGL 4.3.
+	 */
+	class VertexLayout final
+	{
+	public:
+
+		VertexLayout(OpenGL* openGl, const Graphics::VertexElementList& vertexElements);
+
+		VertexLayout(const VertexLayout& vertexLayout) = delete;
+		VertexLayout(VertexLayout&& vertexLayout) = delete;
+
+		~VertexLayout();
+
+		void bind(const Uint32 vertexBufferHandle, const Uint vertexBufferOffset, const Uint32 vertexBufferStride,
+			const Uint32 indexBufferHandle);
+
+		void forgetBuffer(const Uint32 bufferHandle);
+
+		VertexLayout& operator =(const VertexLayout& vertexLayout) = delete;
+		VertexLayout& operator =(VertexLayout&& vertexLayout) = delete;
+
+		static Uint32 getComponentCount(const Graphics::VertexElementType& elementType, Bool& normalise);
+
+		static Uint32 getElementSize(const Graphics::VertexElement& element);
+
+	private:
+
+		Core::SmallVector<Uint32, 2u> _bindingDivisors;
+		OpenGL* _openGl;
+		Uint _vertexBufferOffset;
+		Uint32 _vertexBufferHandle;
+		Uint32 _vertexBufferStride;
+		Uint32 _indexBufferHandle;
+		Uint32 _packedStride;
+		Uint32 _vertexArrayHandle;
+
+		void createVertexArray(const Graphics::VertexElementList& vertexElements);
+		Uint32 getBindingIndex(const Uint32 divisor);
+
+		void setAttributeFormat(const Graphics::VertexElement& element, const Uint32 relativeOffset,
+			const Uint32 bindingIndex) const;
+	};
+}
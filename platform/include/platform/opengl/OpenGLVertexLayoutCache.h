@@ -0,0 +1,76 @@
+/**
+ * @file platform/opengl/OpenGLVertexLayoutCache.h
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <core/FlatMap.h>
+#include <core/Types.h>
+#include <graphics/VertexBufferState.h>
+
+namespace Platform
+{
+	class OpenGL;
+	class VertexLayout;
+
+	/**
+	 * Owns the vertex layouts of a context, keyed by a hash of their vertex
+	 * elements so that equal element lists share a layout.
+	 */
+	class VertexLayoutCache final
+	{
+	public:
+
+		explicit VertexLayoutCache(OpenGL* openGl);
+
+		VertexLayoutCache(const VertexLayoutCache& vertexLayoutCache) = delete;
+		VertexLayoutCache(VertexLayoutCache&& vertexLayoutCache) = delete;
+
+		~VertexLayoutCache();
+
+		/**
+		 * Removes the buffer from the bindings shadowed by the layouts.
+		 */
+		void forgetBuffer(const Uint32 bufferHandle) const;
+
+		VertexLayout* get(const Graphics::VertexElementList& vertexElements);
+
+		VertexLayoutCache& operator =(const VertexLayoutCache& vertexLayoutCache) = delete;
+		VertexLayoutCache& operator =(VertexLayoutCache&& vertexLayoutCache) = delete;
+
+	private:
+
+		struct VertexElementListHash final
+		{
+			Uint operator ()(const Graphics::VertexElementList& vertexElements) const;
+		};
+
+		struct VertexElementListEqual final
+		{
+			Bool operator ()(const Graphics::VertexElementList& vertexElementsA,
+				const Graphics::VertexElementList& vertexElementsB) const;
+		};
+
+		using LayoutMap =
+			Core::FlatMap<Graphics::VertexElementList, VertexLayout*, VertexElementListHash, VertexElementListEqual>;
+
+		LayoutMap _layouts;
+		OpenGL* _openGl;
+	};
+}
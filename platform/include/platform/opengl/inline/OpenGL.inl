@@ -25,7 +25,106 @@ Uint32 OpenGL::bindDefaultVertexArray()
 	return bindVertexArrayCustom(_defaultVertexArrayHandle);
 }
 
+Bool OpenGL::hasDirectStateAccess() const
+{
+	return _hasDirectStateAccess;
+}
+
+Bool OpenGL::hasParallelShaderCompile() const
+{
+	return _hasParallelShaderCompile;
+}
+
+Bool OpenGL::hasVertexAttribBinding() const
+{
+	return _hasVertexAttribBinding;
+}
+
+ProgramBinaryCache& OpenGL::programBinaryCache()
+{
+	return *_programBinaryCache;
+}
+
+void OpenGL::resetStateStatistics()
+{
+	_stateStatistics = Graphics::StateStatistics();
+}
+
+const Graphics::StateStatistics& OpenGL::stateStatistics() const
+{
+	return _stateStatistics;
+}
+
+Uint32 OpenGL::uniformBufferOffsetAlignment() const
+{
+	return _uniformBufferOffsetAlignment;
+}
+
 Uint32 OpenGL::vertexAttributeCount() const
 {
 	return _vertexAttributeCount;
 }
+
+VertexLayoutCache& OpenGL::vertexLayoutCache()
+{
+	return *_vertexLayoutCache;
+}
+
+// Private
+
+void OpenGL::countFilteredCall()
+{
+	++_stateStatistics.filteredCallCount;
+}
+
+void OpenGL::countIssuedCall()
+{
+	++_stateStatistics.issuedCallCount;
+}
+
+// Static
+
+void OpenGL::checkForErrors(const Char8* file, const Uint32 line, const Char8* function)
+{
+	if(_errorCheckMode == Graphics::ErrorCheckMode::Strict)
+	{
+		reportErrors(file, line, function);
+	}
+	else if(_errorCheckMode == Graphics::ErrorCheckMode::Sampled)
+	{
+		if(++_errorCheckCount == ERROR_CHECK_SAMPLE_INTERVAL)
+		{
+			_errorCheckCount = 0u;
+			reportErrors(file, line, function);
+		}
+	}
+}
+
+void DE_CALL_OPENGL OpenGL::queueDebugMessage(Enum source, Enum type, Uint32 id, Enum severity, Sizei length,
+	const Char8* message, const Void* userParam)
+{
+	// May be called on a driver thread, so the message is logged later by the
+	// thread owning the context. A message is dropped if its slot in the ring
+	// has not been logged yet.
+
+	OpenGL* openGl = static_cast<OpenGL*>(const_cast<Void*>(userParam));
+	const Uint32 index = openGl->_nextDebugMessageIndex.fetch_add(1u, std::memory_order_relaxed);
+	DebugMessage* debugMessage = &openGl->_debugMessagePool[index % DEBUG_MESSAGE_COUNT];
+
+	if(debugMessage->isQueued.exchange(true, std::memory_order_acquire))
+	{
+		openGl->_droppedDebugMessageCount.fetch_add(1u, std::memory_order_relaxed);
+		return;
+	}
+
+	const Uint32 messageLength = static_cast<Uint32>(length) < DEBUG_MESSAGE_LENGTH ?
+		static_cast<Uint32>(length) : DEBUG_MESSAGE_LENGTH - 1u;
+
+	std::memcpy(debugMessage->message.data(), message, messageLength);
+	debugMessage->message[messageLength] = '\0';
+	debugMessage->severity = severity;
+	debugMessage->source = source;
+	debugMessage->type = type;
+	debugMessage->id = id;
+	openGl->_debugMessages.push(debugMessage);
+}
@@ -24,3 +24,15 @@ inline Uint32 Effect::Implementation::handle() const
 {
 	return _programHandle;
 }
+
+inline const EffectUniformBlockList& Effect::Implementation::uniformBlocks()
+{
+	finaliseLink();
+	return _uniformBlocks;
+}
+
+inline const EffectUniformList& Effect::Implementation::uniforms()
+{
+	finaliseLink();
+	return _uniforms;
+}
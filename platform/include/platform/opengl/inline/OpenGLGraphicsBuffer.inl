@@ -32,5 +32,13 @@ void GraphicsBuffer::Implementation::debind() const
 
 Uint8* GraphicsBuffer::Implementation::mapData() const
 {
-	return mapData(_size, 0u);
+	return mapData(_size, 0u, MapMode::Default);
+}
+
+// Private
+
+void GraphicsBuffer::Implementation::bindForEditing() const
+{
+	if(!_openGl->hasDirectStateAccess())
+		bind();
 }
@@ -32,5 +32,5 @@ void IndexBuffer::Implementation::debind() const
 
 Uint8* IndexBuffer::Implementation::mapData() const
 {
-	return mapData(_size, 0u);
+	return mapData(_size, 0u, MapMode::Default);
 }
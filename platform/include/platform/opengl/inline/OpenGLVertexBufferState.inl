@@ -20,17 +20,19 @@
 
 // Public
 
-inline Uint32 VertexBufferState::Implementation::bind() const
+IndexBuffer* VertexBufferState::Implementation::indexBuffer() const
 {
-	return _openGl->bindVertexArrayCustom(_vertexArrayHandle);
+	return _indexBuffer;
 }
 
-Uint32 VertexBufferState::Implementation::debind(const Uint32 previousVertexArrayHandle) const
+// Private
+
+Uint32 VertexBufferState::Implementation::bindForEditing() const
 {
-	return _openGl->bindVertexArrayCustom(previousVertexArrayHandle);
+	return _openGl->bindVertexArrayCustom(_vertexArrayHandle);
 }
 
-IndexBuffer* VertexBufferState::Implementation::indexBuffer() const
+Uint32 VertexBufferState::Implementation::debindForEditing(const Uint32 previousVertexArrayHandle) const
 {
-	return _indexBuffer;
+	return _openGl->bindVertexArrayCustom(previousVertexArrayHandle);
 }
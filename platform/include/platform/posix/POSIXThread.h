@@ -21,6 +21,7 @@
 #pragma once
 
 #include <pthread.h>
+#include <core/Array.h>
 #include <core/Thread.h>
 
 namespace Core
@@ -44,7 +45,8 @@ namespace Core
 
 		Int32 join() const;
 
-		void run(ThreadEntryFunction entryFunction, Void* parameter, const Bool isJoinable);
+		void run(ThreadEntryFunction entryFunction, Void* parameter, const ThreadOptions& options,
+			const Bool isJoinable);
 
 		Implementation& operator =(const Implementation& implementation) = delete;
 		Implementation& operator =(Implementation&& implementation) = delete;
@@ -58,12 +60,17 @@ namespace Core
 			ThreadEntryFunction entryFunction;
 			Void* userParameter;
 			Implementation* thread;
+			Uint64 affinityMask;
+			ThreadPriority priority;
+			Core::Array<Char8, ThreadOptions::MAX_NAME_LENGTH + 1u> name;
 		};
 
 		pthread_t _threadHandle;
 		Uint32 _id;
 		Bool _isJoinable;
 
+		static void applyOptions(const ThreadParameter& parameter);
+
 		static Void* entryFunction(Void* parameter);
 	};
 
@@ -0,0 +1,70 @@
+/**
+ * @file platform/linux/LinuxFutex.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <climits>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <core/Futex.h>
+#include <core/Log.h>
+#include <platform/posix/POSIX.h>
+
+using namespace Core;
+
+// External
+
+static const Char8* COMPONENT_TAG = "[Core::Futex - Linux] ";
+
+static long futex(std::atomic<Uint32>& value, const Int32 operation, const Uint32 operand);
+
+
+// Public
+
+// Static
+
+void Futex::wait(std::atomic<Uint32>& value, const Uint32 expectedValue)
+{
+	const long result = ::futex(value, FUTEX_WAIT_PRIVATE, expectedValue);
+
+	if(result == -1 && errno != EAGAIN && errno != EINTR)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to wait on the futex." << Log::Flush();
+		DE_ERROR_POSIX(0x0);
+	}
+}
+
+void Futex::wakeAll(std::atomic<Uint32>& value)
+{
+	::futex(value, FUTEX_WAKE_PRIVATE, INT_MAX);
+}
+
+void Futex::wakeOne(std::atomic<Uint32>& value)
+{
+	::futex(value, FUTEX_WAKE_PRIVATE, 1u);
+}
+
+
+// External
+
+static long futex(std::atomic<Uint32>& value, const Int32 operation, const Uint32 operand)
+{
+	static_assert(sizeof(std::atomic<Uint32>) == sizeof(Uint32), "The futex word must be 32 bits wide.");
+	return syscall(SYS_futex, reinterpret_cast<Uint32*>(&value), operation, operand, nullptr, nullptr, 0);
+}
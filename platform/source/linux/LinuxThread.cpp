@@ -18,11 +18,25 @@
  * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
 #include <unistd.h>
+#include <sys/resource.h>
 #include <sys/syscall.h>
+#include <core/Log.h>
+#include <platform/posix/POSIX.h>
 #include <platform/posix/POSIXThread.h>
 
 using namespace Core;
+using namespace Platform;
+
+// External
+
+static const Char8* COMPONENT_TAG = "[Core::Thread - Linux] ";
+
+static Int32 getNiceValue(const ThreadPriority& priority);
+
 
 // Public
 
@@ -32,3 +46,75 @@ Uint32 Thread::Implementation::currentID()
 {
 	return static_cast<Uint32>(syscall(SYS_gettid));
 }
+
+// Private
+
+// Static
+
+void Thread::Implementation::applyOptions(const ThreadParameter& parameter)
+{
+	if(parameter.name[0] != '\0')
+	{
+		const Int32 result = pthread_setname_np(pthread_self(), parameter.name.data());
+
+		if(result != POSIX_RESULT_OK)
+		{
+			defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "Failed to set the thread name." <<
+				Log::Flush();
+		}
+	}
+
+	if(parameter.affinityMask != 0u)
+	{
+		cpu_set_t processorSet;
+		CPU_ZERO(&processorSet);
+
+		for(Uint32 i = 0u; i < 64u; ++i)
+		{
+			if((parameter.affinityMask & (1ull << i)) != 0u)
+				CPU_SET(i, &processorSet);
+		}
+
+		if(sched_setaffinity(0, sizeof(cpu_set_t), &processorSet) == -1)
+		{
+			defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "Failed to set the thread affinity (" <<
+				errno << ")." << Log::Flush();
+		}
+	}
+
+	if(parameter.priority != ThreadPriority::Normal)
+	{
+		// Threads are scheduled individually on Linux, so the nice value of the
+		// thread ID only affects the calling thread
+
+		if(setpriority(PRIO_PROCESS, currentID(), ::getNiceValue(parameter.priority)) == -1)
+		{
+			defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "Failed to set the thread priority (" <<
+				errno << ")." << Log::Flush();
+		}
+	}
+}
+
+
+// External
+
+static Int32 getNiceValue(const ThreadPriority& priority)
+{
+	switch(priority)
+	{
+		case ThreadPriority::Lowest:
+			return 10;
+
+		case ThreadPriority::Low:
+			return 5;
+
+		case ThreadPriority::High:
+			return -5;
+
+		case ThreadPriority::Highest:
+			return -10;
+
+		default:
+			return 0;
+	}
+}
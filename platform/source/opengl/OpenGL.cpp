@@ -20,8 +20,12 @@
 
 #include <core/Error.h>
 #include <core/Log.h>
+#include <core/Memory.h>
+#include <core/debug/Assert.h>
 #include <platform/GraphicsFunctionUtility.h>
 #include <platform/opengl/OpenGL.h>
+#include <platform/opengl/OpenGLProgramBinaryCache.h>
+#include <platform/opengl/OpenGLVertexLayoutCache.h>
 
 using namespace Core;
 using namespace Graphics;
@@ -31,7 +35,13 @@ using namespace Platform;
 
 static const Char8* COMPONENT_TAG = "[Platform::OpenGL] ";
 
-/*static const Array<const Char8*, 6u> DEBUG_MESSAGE_SOURCE_NAMES
+#if defined(DE_INTERNAL_BUILD_DEVELOPMENT)
+static const ErrorCheckMode DEFAULT_ERROR_CHECK_MODE = ErrorCheckMode::Callback;
+#else
+static const ErrorCheckMode DEFAULT_ERROR_CHECK_MODE = ErrorCheckMode::Off;
+#endif
+
+static const Array<const Char8*, 6u> DEBUG_MESSAGE_SOURCE_NAMES
 {{
 	"OpenGL",
 	"window system",
@@ -53,7 +63,7 @@ static const Array<const Char8*, 10u> DEBUG_MESSAGE_TYPE_NAMES
 	"Portability",
 	"Undefined behaviour",
 	"Unknown"
-}};*/
+}};
 
 static const Array<const Char8*, 7u> ERROR_NAMES
 {{
@@ -66,6 +76,9 @@ static const Array<const Char8*, 7u> ERROR_NAMES
 	"Invalid framebuffer operation"
 }};
 
+static LogLevel getDebugMessageLogLevel(const Uint32 messageSeverity);
+static const Char8* getDebugMessageSourceName(const Uint32 messageSource);
+static const Char8* getDebugMessageTypeName(const Uint32 messageType);
 static void reportError(const Uint32 errorCode, const Char8* file, const Uint32 line, const Char8* function);
 
 
@@ -781,6 +794,10 @@ OpenGL::VertexArrayElementBuffer OpenGL::vertexArrayElementBuffer = nullptr;
 OpenGL::VertexArrayVertexBuffer OpenGL::vertexArrayVertexBuffer = nullptr;
 OpenGL::VertexArrayVertexBuffers OpenGL::vertexArrayVertexBuffers = nullptr;
 
+// GL_KHR_parallel_shader_compile
+
+OpenGL::MaxShaderCompilerThreadsKHR OpenGL::maxShaderCompilerThreadsKHR = nullptr;
+
 const Array<Version, 7u> OpenGL::SUPPORTED_VERSIONS
 {{
 	Version(3u, 3u),
@@ -792,69 +809,226 @@ const Array<Version, 7u> OpenGL::SUPPORTED_VERSIONS
 	Version(4u, 5u)
 }};
 
+ErrorCheckMode OpenGL::_errorCheckMode = ErrorCheckMode::Strict;
+Uint32 OpenGL::_errorCheckCount = 0u;
+
 OpenGL::OpenGL()
-	: _version(0u, 0u),
+	: _nextDebugMessageIndex(0u),
+	  _droppedDebugMessageCount(0u),
+	  _version(0u, 0u),
+	  _stateStatistics(),
 	  _activeVertexArrayHandle(0u),
+	  _activeProgramHandle(0u),
 	  _defaultVertexArrayHandle(0u),
-	  _vertexAttributeCount(0u)
+	  _uniformBufferOffsetAlignment(0u),
+	  _vertexAttributeCount(0u),
+	  _programBinaryCache(nullptr),
+	  _vertexLayoutCache(nullptr),
+	  _hasDirectStateAccess(false),
+	  _hasParallelShaderCompile(false),
+	  _hasVertexAttribBinding(false)
 {
 	_activeGraphicsBuffers.fill(0u);
 	initialiseVersion();
 	checkSupport();
 	getStandardFunctions();
+	getExtensionFunctions();
+	setErrorCheckMode(::DEFAULT_ERROR_CHECK_MODE);
 	getCapabilities();
+	_hasDirectStateAccess = !(_version < Version(4u, 5u));
+	_hasVertexAttribBinding = !(_version < Version(4u, 3u));
 	logInfo();
 	createDefaultVertexArray();
+	initialiseState();
+	_programBinaryCache = DE_NEW(ProgramBinaryCache)();
+	_vertexLayoutCache = DE_NEW(VertexLayoutCache)(this);
 }
 
 OpenGL::~OpenGL()
 {
+	setErrorCheckMode(ErrorCheckMode::Off);
+	logDebugMessages();
+	DE_DELETE(_vertexLayoutCache, VertexLayoutCache);
+	DE_DELETE(_programBinaryCache, ProgramBinaryCache);
 	deleteVertexArrays(1, &_defaultVertexArrayHandle);
 	DE_CHECK_ERROR_OPENGL();
 }
 
+void OpenGL::bindBufferBaseCustom(const Uint32 binding, const Uint32 bindingIndex, const Uint32 bufferHandle)
+{
+	setIndexedBufferBinding(binding, bindingIndex, bufferHandle, 0u, 0u);
+}
+
+void OpenGL::bindBufferRangeCustom(const Uint32 binding, const Uint32 bindingIndex, const Uint32 bufferHandle,
+	const Uint offset, const Uint size)
+{
+	DE_ASSERT(size > 0u);
+	setIndexedBufferBinding(binding, bindingIndex, bufferHandle, offset, size);
+}
+
 void OpenGL::bindGraphicsBuffer(const Uint32 binding, const Uint32 bufferHandle)
 {
 	const Uint32 bindingIndex = binding & 0x0F;
 
-	if(_activeGraphicsBuffers[bindingIndex] != bufferHandle)
+	if(_activeGraphicsBuffers[bindingIndex] == bufferHandle)
 	{
-		bindBuffer(binding >> 4, bufferHandle);
-		DE_CHECK_ERROR_OPENGL();
-		_activeGraphicsBuffers[bindingIndex] = bufferHandle;
+		countFilteredCall();
+		return;
 	}
+
+	bindBuffer(binding >> 4, bufferHandle);
+	DE_CHECK_ERROR_OPENGL();
+	countIssuedCall();
+	_activeGraphicsBuffers[bindingIndex] = bufferHandle;
 }
 
 Uint32 OpenGL::bindVertexArrayCustom(const Uint32 vertexArrayHandle)
 {
-#if DE_BUILD == DE_BUILD_DEBUG
-
-	if(vertexArrayHandle == _activeVertexArrayHandle)
-		return _activeVertexArrayHandle;
-
-#else
+	// Restoring the zero vertex array is skipped, as nothing can be drawn or specified with it bound
 
 	if(vertexArrayHandle == _activeVertexArrayHandle || vertexArrayHandle == 0u)
+	{
+		countFilteredCall();
 		return _activeVertexArrayHandle;
-
-#endif
+	}
 
 	const Uint32 previousVertexArrayHandle = _activeVertexArrayHandle;
 	bindVertexArray(vertexArrayHandle);
 	DE_CHECK_ERROR_OPENGL();
+	countIssuedCall();
 	_activeVertexArrayHandle = vertexArrayHandle;
 
 	return previousVertexArrayHandle;
 }
 
-// Static
+void OpenGL::deleteBufferCustom(const Uint32 bufferHandle)
+{
+	deleteBuffers(1, &bufferHandle);
+	DE_CHECK_ERROR_OPENGL();
+
+	for(Uint32& activeBufferHandle : _activeGraphicsBuffers)
+	{
+		if(activeBufferHandle == bufferHandle)
+			activeBufferHandle = 0u;
+	}
+
+	for(IndexedBufferBinding& activeBinding : _activeUniformBuffers)
+	{
+		if(activeBinding.bufferHandle == bufferHandle)
+			activeBinding = IndexedBufferBinding();
+	}
 
-void OpenGL::checkForErrors(const Char8* file, const Uint32 line, const Char8* function)
+	_vertexLayoutCache->forgetBuffer(bufferHandle);
+}
+
+void OpenGL::deleteProgramCustom(const Uint32 programHandle)
 {
-	Uint32 errorCode;
+	deleteProgram(programHandle);
+	DE_CHECK_ERROR_OPENGL();
 
-	while((errorCode = getError()) != NO_ERROR)
-		::reportError(errorCode, file, line, function);
+	if(programHandle == _activeProgramHandle)
+		_activeProgramHandle = 0u;
+}
+
+void OpenGL::deleteVertexArrayCustom(const Uint32 vertexArrayHandle)
+{
+	deleteVertexArrays(1, &vertexArrayHandle);
+	DE_CHECK_ERROR_OPENGL();
+
+	if(vertexArrayHandle == _activeVertexArrayHandle)
+		_activeVertexArrayHandle = 0u;
+}
+
+void OpenGL::logDebugMessages()
+{
+	DebugMessage* debugMessage;
+
+	while((debugMessage = _debugMessages.pop()) != nullptr)
+	{
+		defaultLog << ::getDebugMessageLogLevel(debugMessage->severity) << ::COMPONENT_TAG <<
+			::getDebugMessageTypeName(debugMessage->type) << " message " << debugMessage->id << " from " <<
+			::getDebugMessageSourceName(debugMessage->source) << ": " << debugMessage->message.data() <<
+			Log::Flush();
+
+		debugMessage->isQueued.store(false, std::memory_order_release);
+	}
+
+	const Uint32 droppedMessageCount = _droppedDebugMessageCount.exchange(0u, std::memory_order_relaxed);
+
+	if(droppedMessageCount > 0u)
+	{
+		defaultLog << LogLevel::Warning << ::COMPONENT_TAG << droppedMessageCount <<
+			" debug message(s) dropped, as they arrived faster than they were logged." << Log::Flush();
+	}
+}
+
+void OpenGL::setErrorCheckMode(const ErrorCheckMode& errorCheckMode)
+{
+	_errorCheckMode = errorCheckMode;
+	_errorCheckCount = 0u;
+
+	if(errorCheckMode == ErrorCheckMode::Callback && debugMessageCallback == nullptr)
+	{
+		defaultLog << LogLevel::Warning << ::COMPONENT_TAG <<
+			"The debug callback requires OpenGL 4.3. Errors are checked after each call instead." << Log::Flush();
+
+		_errorCheckMode = ErrorCheckMode::Strict;
+	}
+
+	if(debugMessageCallback != nullptr)
+	{
+		if(_errorCheckMode == ErrorCheckMode::Callback)
+		{
+			// Notifications are informational and too frequent to log
+
+			debugMessageCallback(OpenGL::queueDebugMessage, this);
+			debugMessageControl(DONT_CARE, DONT_CARE, DONT_CARE, 0, nullptr, TRUE);
+			debugMessageControl(DONT_CARE, DONT_CARE, DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, FALSE);
+			enable(DEBUG_OUTPUT);
+		}
+		else
+		{
+			disable(DEBUG_OUTPUT);
+			debugMessageCallback(nullptr, nullptr);
+		}
+	}
+
+	// Any error left from before the switch is reported, and cleared so that
+	// it is not attributed to a later call
+
+	reportErrors(DE_FILE, DE_LINE, DE_FUNCTION);
+}
+
+Uint32 OpenGL::useProgramCustom(const Uint32 programHandle)
+{
+	if(programHandle == _activeProgramHandle)
+	{
+		countFilteredCall();
+		return _activeProgramHandle;
+	}
+
+	const Uint32 previousProgramHandle = _activeProgramHandle;
+	useProgram(programHandle);
+	DE_CHECK_ERROR_OPENGL();
+	countIssuedCall();
+	_activeProgramHandle = programHandle;
+
+	return previousProgramHandle;
+}
+
+void OpenGL::viewportCustom(const Int32 x, const Int32 y, const Sizei width, const Sizei height)
+{
+	if(x == _activeViewport[0] && y == _activeViewport[1] && width == _activeViewport[2] &&
+		height == _activeViewport[3])
+	{
+		countFilteredCall();
+		return;
+	}
+
+	viewport(x, y, width, height);
+	DE_CHECK_ERROR_OPENGL();
+	countIssuedCall();
+	_activeViewport = {{ x, y, width, height }};
 }
 
 // Private
@@ -2244,8 +2418,39 @@ void OpenGL::getStandardFunctions() const
 	}
 }
 
+void OpenGL::getExtensionFunctions()
+{
+	const ExtensionNameList extensionNames = getExtensionNames();
+	const ExtensionNameSet extensionNameSet(extensionNames.begin(), extensionNames.end());
+	GraphicsFunctionUtility functionUtility;
+
+	// GL_KHR_parallel_shader_compile
+
+	if(extensionNameSet.count("GL_KHR_parallel_shader_compile") != 0u)
+	{
+		maxShaderCompilerThreadsKHR =
+			functionUtility.getExtensionFunction<MaxShaderCompilerThreadsKHR>("glMaxShaderCompilerThreadsKHR");
+	}
+	else if(extensionNameSet.count("GL_ARB_parallel_shader_compile") != 0u)
+	{
+		maxShaderCompilerThreadsKHR =
+			functionUtility.getExtensionFunction<MaxShaderCompilerThreadsKHR>("glMaxShaderCompilerThreadsARB");
+	}
+
+	_hasParallelShaderCompile = maxShaderCompilerThreadsKHR != nullptr;
+
+	// Lets the implementation pick the number of compiler threads
+
+	if(_hasParallelShaderCompile)
+	{
+		maxShaderCompilerThreadsKHR(0xFFFFFFFF);
+		DE_CHECK_ERROR_OPENGL();
+	}
+}
+
 void OpenGL::getCapabilities()
 {
+	_uniformBufferOffsetAlignment = getInteger(UNIFORM_BUFFER_OFFSET_ALIGNMENT);
 	_vertexAttributeCount = getInteger(MAX_VERTEX_ATTRIBS);
 }
 
@@ -2261,18 +2466,62 @@ void OpenGL::logInfo() const
 		"\nVendor:                   " << vendor << "\nRenderer:                 " << renderer << '\n' <<
 		Log::Flush();
 
-	defaultLog << LogLevel::Info << "OpenGL capabilities\n\nVertex attribute count: " <<
-		_vertexAttributeCount << '\n' << Log::Flush();
+	defaultLog << LogLevel::Info << "OpenGL capabilities\n\nDirect state access:             " <<
+		(_hasDirectStateAccess ? "Yes" : "No") << "\nParallel shader compile:         " <<
+		(_hasParallelShaderCompile ? "Yes" : "No") << "\nUniform buffer offset alignment: " <<
+		_uniformBufferOffsetAlignment << "\nVertex attribute binding:        " <<
+		(_hasVertexAttribBinding ? "Yes" : "No") << "\nVertex attribute count:          " << _vertexAttributeCount <<
+		'\n' << Log::Flush();
 
 	logGraphicsExtensions("OpenGL", getExtensionNames());
 }
 
 void OpenGL::createDefaultVertexArray()
 {
-	genVertexArrays(1, &_defaultVertexArrayHandle);
+	if(_hasDirectStateAccess)
+		createVertexArrays(1, &_defaultVertexArrayHandle);
+	else
+		genVertexArrays(1, &_defaultVertexArrayHandle);
+
 	DE_CHECK_ERROR_OPENGL();
 }
 
+void OpenGL::initialiseState()
+{
+	_activeUniformBuffers.resize(getInteger(MAX_UNIFORM_BUFFER_BINDINGS), IndexedBufferBinding());
+	getIntegerv(VIEWPORT, _activeViewport.data());
+	DE_CHECK_ERROR_OPENGL();
+}
+
+void OpenGL::setIndexedBufferBinding(const Uint32 binding, const Uint32 bindingIndex, const Uint32 bufferHandle,
+	const Uint offset, const Uint size)
+{
+	DE_ASSERT((binding >> 4) == UNIFORM_BUFFER);
+	DE_ASSERT(bindingIndex < _activeUniformBuffers.size());
+	IndexedBufferBinding& activeBinding = _activeUniformBuffers[bindingIndex];
+
+	if(activeBinding.bufferHandle == bufferHandle && activeBinding.offset == offset && activeBinding.size == size)
+	{
+		countFilteredCall();
+		return;
+	}
+
+	if(size == 0u)
+		bindBufferBase(binding >> 4, bindingIndex, bufferHandle);
+	else
+		bindBufferRange(binding >> 4, bindingIndex, bufferHandle, offset, size);
+
+	DE_CHECK_ERROR_OPENGL();
+	countIssuedCall();
+	activeBinding.bufferHandle = bufferHandle;
+	activeBinding.offset = offset;
+	activeBinding.size = size;
+
+	// Binding to an indexed binding point also binds to the generic one
+
+	_activeGraphicsBuffers[binding & 0x0F] = bufferHandle;
+}
+
 // Static
 
 const Char8* OpenGL::getCharacters(const Uint32 name)
@@ -2314,10 +2563,18 @@ Int32 OpenGL::getInteger(const Uint32 name)
 	return value;
 }
 
+void OpenGL::reportErrors(const Char8* file, const Uint32 line, const Char8* function)
+{
+	Uint32 errorCode;
+
+	while((errorCode = getError()) != NO_ERROR)
+		::reportError(errorCode, file, line, function);
+}
+
 
 // External
 
-/*static LogLevel getDebugMessageLogLevel(const Uint32 messageSeverity)
+static LogLevel getDebugMessageLogLevel(const Uint32 messageSeverity)
 {
 	switch(messageSeverity)
 	{
@@ -2336,6 +2593,14 @@ Int32 OpenGL::getInteger(const Uint32 name)
 	}
 }
 
+static const Char8* getDebugMessageSourceName(const Uint32 messageSource)
+{
+	if(messageSource >= OpenGL::DEBUG_SOURCE_API && messageSource <= OpenGL::DEBUG_SOURCE_OTHER)
+		return ::DEBUG_MESSAGE_SOURCE_NAMES[messageSource - OpenGL::DEBUG_SOURCE_API];
+
+	return ::DEBUG_MESSAGE_SOURCE_NAMES[5];
+}
+
 static const Char8* getDebugMessageTypeName(const Uint32 messageType)
 {
 	switch(messageType)
@@ -2370,7 +2635,7 @@ static const Char8* getDebugMessageTypeName(const Uint32 messageType)
 		default:
 			return ::DEBUG_MESSAGE_TYPE_NAMES[9];
 	}
-}*/
+}
 
 static void reportError(const Uint32 errorCode, const Char8* file, const Uint32 line, const Char8* function)
 {
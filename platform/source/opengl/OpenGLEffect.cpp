@@ -18,28 +18,46 @@
  * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <core/Error.h>
 #include <core/Log.h>
 #include <core/Memory.h>
+#include <core/SmallVector.h>
+#include <core/StringView.h>
+#include <core/debug/Assert.h>
+#include <core/maths/Matrix4.h>
+#include <core/maths/Vector2.h>
+#include <core/maths/Vector3.h>
+#include <core/maths/Vector4.h>
 #include <platform/opengl/OpenGL.h>
 #include <platform/opengl/OpenGLEffect.h>
+#include <platform/opengl/OpenGLProgramBinaryCache.h>
 #include <platform/opengl/OpenGLShader.h>
 
 using namespace Core;
 using namespace Graphics;
+using namespace Maths;
 using namespace Platform;
 
 // External
 
 static const Char8* COMPONENT_TAG = "[Graphics::Effect - OpenGL] ";
 
+static UniformType getUniformType(const Uint32 typeId);
+
+template<typename ProgramFunction, typename Function, typename... Parameters>
+static void setUniform(ProgramFunction programFunction, Function function, const Uint32 programHandle,
+	const Int32 location, Parameters... parameters);
+
 
 // Implementation
 
 // Public
 
 Effect::Implementation::Implementation()
-	: _programHandle(0u)
+	: _sourceHash(0u),
+	  _programHandle(0u),
+	  _isLinkPending(false)
 {
 	_programHandle = OpenGL::createProgram();
 
@@ -54,23 +72,157 @@ Effect::Implementation::Implementation()
 
 Effect::Implementation::~Implementation()
 {
-	OpenGL::deleteProgram(_programHandle);
-	DE_CHECK_ERROR_OPENGL();
+	deletePendingShaders();
+	OpenGL::instance().deleteProgramCustom(_programHandle);
 }
 
-void Effect::Implementation::attachShader(Shader* shader) const
+void Effect::Implementation::attachShader(Shader* shader)
 {
 	const Uint32 shaderHandle = shader->_implementation->handle();
 	OpenGL::attachShader(_programHandle, shaderHandle);
 	DE_CHECK_ERROR_OPENGL();
+	_pendingShaders.push_back(shader);
+}
+
+void Effect::Implementation::finaliseLink()
+{
+	if(_isLinkPending)
+	{
+		// A failed compilation is reported with the compiler log rather than the linker log
+
+		for(ShaderList::const_iterator i = _pendingShaders.begin(), end = _pendingShaders.end(); i != end; ++i)
+			(*i)->_implementation->checkCompilationStatus();
+
+		checkLinkingStatus();
+		detachShaders();
+		deletePendingShaders();
+		_isLinkPending = false;
+		OpenGL::instance().programBinaryCache().store(_programHandle, _sourceHash);
+		reflect();
+	}
+}
+
+const EffectUniform* Effect::Implementation::findUniform(const Name& name)
+{
+	finaliseLink();
+	const NameIndexMap::const_iterator iterator = _uniformIndices.find(name);
+
+	if(iterator == _uniformIndices.end())
+		return nullptr;
+
+	return &_uniforms[iterator->second];
+}
+
+const EffectUniformBlock* Effect::Implementation::findUniformBlock(const Name& name)
+{
+	finaliseLink();
+	const NameIndexMap::const_iterator iterator = _uniformBlockIndices.find(name);
+
+	if(iterator == _uniformBlockIndices.end())
+		return nullptr;
+
+	return &_uniformBlocks[iterator->second];
+}
+
+Bool Effect::Implementation::isLinkComplete() const
+{
+	if(_isLinkPending && OpenGL::instance().hasParallelShaderCompile())
+		return getParameter(OpenGL::COMPLETION_STATUS_KHR) == OpenGL::TRUE;
+
+	return true;
 }
 
-void Effect::Implementation::link() const
+void Effect::Implementation::link(const Uint64 sourceHash)
 {
+	DE_ASSERT(!_isLinkPending);
+
+	if(OpenGL::instance().programBinaryCache().isEnabled())
+	{
+		OpenGL::programParameteri(_programHandle, OpenGL::PROGRAM_BINARY_RETRIEVABLE_HINT, OpenGL::TRUE);
+		DE_CHECK_ERROR_OPENGL();
+	}
+
 	OpenGL::linkProgram(_programHandle);
 	DE_CHECK_ERROR_OPENGL();
-	checkLinkingStatus();
-	detachShaders();
+	_sourceHash = sourceHash;
+	_isLinkPending = true;
+}
+
+Bool Effect::Implementation::loadBinary(const Uint64 sourceHash)
+{
+	DE_ASSERT(!_isLinkPending);
+
+	if(!OpenGL::instance().programBinaryCache().load(_programHandle, sourceHash))
+		return false;
+
+	reflect();
+
+	return true;
+}
+
+void Effect::Implementation::setUniform(const Name& name, const Float32 value)
+{
+	const Int32 location = getUniformLocation(name);
+
+	if(location != -1)
+		::setUniform(OpenGL::programUniform1f, OpenGL::uniform1f, _programHandle, location, value);
+}
+
+void Effect::Implementation::setUniform(const Name& name, const Int32 value)
+{
+	const Int32 location = getUniformLocation(name);
+
+	if(location != -1)
+		::setUniform(OpenGL::programUniform1i, OpenGL::uniform1i, _programHandle, location, value);
+}
+
+void Effect::Implementation::setUniform(const Name& name, const Matrix4& value)
+{
+	const Int32 location = getUniformLocation(name);
+
+	if(location != -1)
+	{
+		::setUniform(OpenGL::programUniformMatrix4fv, OpenGL::uniformMatrix4fv, _programHandle, location, 1,
+			OpenGL::FALSE, value.data());
+	}
+}
+
+void Effect::Implementation::setUniform(const Name& name, const Vector2& value)
+{
+	const Int32 location = getUniformLocation(name);
+
+	if(location != -1)
+		::setUniform(OpenGL::programUniform2f, OpenGL::uniform2f, _programHandle, location, value.x, value.y);
+}
+
+void Effect::Implementation::setUniform(const Name& name, const Vector3& value)
+{
+	const Int32 location = getUniformLocation(name);
+
+	if(location != -1)
+	{
+		::setUniform(OpenGL::programUniform3f, OpenGL::uniform3f, _programHandle, location, value.x, value.y,
+			value.z);
+	}
+}
+
+void Effect::Implementation::setUniform(const Name& name, const Vector4& value)
+{
+	const Int32 location = getUniformLocation(name);
+
+	if(location != -1)
+	{
+		::setUniform(OpenGL::programUniform4f, OpenGL::uniform4f, _programHandle, location, value.x, value.y,
+			value.z, value.w);
+	}
+}
+
+void Effect::Implementation::setUniformBlockBinding(const Name& blockName, const Uint32 bindingIndex)
+{
+	const EffectUniformBlock* block = findUniformBlock(blockName);
+
+	if(block != nullptr)
+		setUniformBlockBinding(block->index, bindingIndex);
 }
 
 void Effect::Implementation::setUniformBlockBinding(const Uint32 blockIndex, const Uint32 bindingIndex) const
@@ -96,9 +248,17 @@ void Effect::Implementation::checkLinkingStatus() const
 	}
 }
 
+void Effect::Implementation::deletePendingShaders()
+{
+	for(ShaderList::iterator i = _pendingShaders.begin(), end = _pendingShaders.end(); i != end; ++i)
+		DE_DELETE(*i, Shader);
+
+	_pendingShaders.clear();
+}
+
 void Effect::Implementation::detachShaders() const
 {
-	using ShaderHandleList = Vector<Uint32>;
+	using ShaderHandleList = SmallVector<Uint32, 8u>;
 	const Int32 shaderCount = getParameter(OpenGL::ATTACHED_SHADERS);
 
 	if(shaderCount > 0)
@@ -125,6 +285,128 @@ Int32 Effect::Implementation::getParameter(const Uint32 parameterName) const
 	return parameter;
 }
 
+Int32 Effect::Implementation::getUniformLocation(const Name& name)
+{
+	const EffectUniform* uniform = findUniform(name);
+
+	if(uniform == nullptr)
+		return -1;
+
+	DE_ASSERT(uniform->blockIndex == EffectUniform::DEFAULT_BLOCK);
+	return uniform->location;
+}
+
+Effect::Implementation::ParameterList Effect::Implementation::getUniformParameters(
+	const UniformIndexList& uniformIndices, const Uint32 parameterName) const
+{
+	ParameterList parameters(uniformIndices.size());
+
+	OpenGL::getActiveUniformsiv(_programHandle, static_cast<Int32>(uniformIndices.size()), uniformIndices.data(),
+		parameterName, parameters.data());
+
+	DE_CHECK_ERROR_OPENGL();
+	return parameters;
+}
+
+void Effect::Implementation::reflect()
+{
+	reflectUniformBlocks();
+	reflectUniforms();
+}
+
+void Effect::Implementation::reflectUniformBlocks()
+{
+	const Int32 blockCount = getParameter(OpenGL::ACTIVE_UNIFORM_BLOCKS);
+	_uniformBlocks.clear();
+	_uniformBlockIndices.clear();
+
+	if(blockCount <= 0)
+		return;
+
+	CharacterBuffer nameBuffer(getParameter(OpenGL::ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH));
+	_uniformBlocks.reserve(blockCount);
+
+	for(Uint32 i = 0u; i < static_cast<Uint32>(blockCount); ++i)
+	{
+		Int32 nameLength = 0;
+		Int32 size = 0;
+
+		OpenGL::getActiveUniformBlockName(_programHandle, i, static_cast<Int32>(nameBuffer.size()), &nameLength,
+			nameBuffer.data());
+
+		DE_CHECK_ERROR_OPENGL();
+		OpenGL::getActiveUniformBlockiv(_programHandle, i, OpenGL::UNIFORM_BLOCK_DATA_SIZE, &size);
+		DE_CHECK_ERROR_OPENGL();
+		const Name name(StringView8(nameBuffer.data(), nameLength));
+		_uniformBlockIndices.emplace(name, static_cast<Uint32>(_uniformBlocks.size()));
+		_uniformBlocks.push_back({ name, i, static_cast<Uint32>(size) });
+	}
+}
+
+void Effect::Implementation::reflectUniforms()
+{
+	const Int32 uniformCount = getParameter(OpenGL::ACTIVE_UNIFORMS);
+	_uniforms.clear();
+	_uniformIndices.clear();
+
+	if(uniformCount <= 0)
+		return;
+
+	CharacterBuffer nameBuffer(getParameter(OpenGL::ACTIVE_UNIFORM_MAX_LENGTH));
+	UniformIndexList uniformIndices(uniformCount);
+
+	for(Uint32 i = 0u; i < uniformIndices.size(); ++i)
+		uniformIndices[i] = i;
+
+	const ParameterList blockIndices = getUniformParameters(uniformIndices, OpenGL::UNIFORM_BLOCK_INDEX);
+	const ParameterList offsets = getUniformParameters(uniformIndices, OpenGL::UNIFORM_OFFSET);
+	const ParameterList arrayStrides = getUniformParameters(uniformIndices, OpenGL::UNIFORM_ARRAY_STRIDE);
+	const ParameterList matrixStrides = getUniformParameters(uniformIndices, OpenGL::UNIFORM_MATRIX_STRIDE);
+	const ParameterList rowMajorFlags = getUniformParameters(uniformIndices, OpenGL::UNIFORM_IS_ROW_MAJOR);
+	_uniforms.reserve(uniformCount);
+
+	for(Uint32 i = 0u; i < uniformIndices.size(); ++i)
+	{
+		Int32 nameLength = 0;
+		Int32 arraySize = 0;
+		Uint32 typeId = 0u;
+
+		OpenGL::getActiveUniform(_programHandle, i, static_cast<Int32>(nameBuffer.size()), &nameLength,
+			&arraySize, &typeId, nameBuffer.data());
+
+		DE_CHECK_ERROR_OPENGL();
+		const Uint32 blockIndex = static_cast<Uint32>(blockIndices[i]);
+		Int32 location = -1;
+
+		if(blockIndex == EffectUniform::DEFAULT_BLOCK)
+		{
+			location = OpenGL::getUniformLocation(_programHandle, nameBuffer.data());
+			DE_CHECK_ERROR_OPENGL();
+		}
+
+		// Arrays are reported as their first element
+
+		if(nameLength > 3 && std::equal(nameBuffer.data() + nameLength - 3, nameBuffer.data() + nameLength, "[0]"))
+			nameLength -= 3;
+
+		const Name name(StringView8(nameBuffer.data(), nameLength));
+		_uniformIndices.emplace(name, static_cast<Uint32>(_uniforms.size()));
+
+		if(blockIndex == EffectUniform::DEFAULT_BLOCK)
+		{
+			_uniforms.push_back({ name, ::getUniformType(typeId), location, blockIndex, 0u,
+				static_cast<Uint32>(arraySize), 0u, 0u, false });
+		}
+		else
+		{
+			_uniforms.push_back({ name, ::getUniformType(typeId), location, blockIndex,
+				static_cast<Uint32>(offsets[i]), static_cast<Uint32>(arraySize),
+				static_cast<Uint32>(arrayStrides[i]), static_cast<Uint32>(matrixStrides[i]),
+				rowMajorFlags[i] != 0 });
+		}
+	}
+}
+
 void Effect::Implementation::outputLinkerFailureLog() const
 {
 	defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to link the program:";
@@ -165,11 +447,76 @@ Effect::Implementation::CharacterBuffer Effect::Implementation::getInfoLog(const
 
 // Public
 
+Bool Effect::isReady() const
+{
+	if(!_implementation->isLinkComplete())
+		return false;
+
+	_implementation->finaliseLink();
+
+	return true;
+}
+
+const EffectUniform* Effect::findUniform(const Name& name) const
+{
+	return _implementation->findUniform(name);
+}
+
+const EffectUniformBlock* Effect::findUniformBlock(const Name& name) const
+{
+	return _implementation->findUniformBlock(name);
+}
+
+void Effect::setUniform(const Name& name, const Float32 value) const
+{
+	_implementation->setUniform(name, value);
+}
+
+void Effect::setUniform(const Name& name, const Int32 value) const
+{
+	_implementation->setUniform(name, value);
+}
+
+void Effect::setUniform(const Name& name, const Matrix4& value) const
+{
+	_implementation->setUniform(name, value);
+}
+
+void Effect::setUniform(const Name& name, const Vector2& value) const
+{
+	_implementation->setUniform(name, value);
+}
+
+void Effect::setUniform(const Name& name, const Vector3& value) const
+{
+	_implementation->setUniform(name, value);
+}
+
+void Effect::setUniform(const Name& name, const Vector4& value) const
+{
+	_implementation->setUniform(name, value);
+}
+
+void Effect::setUniformBlockBinding(const Name& blockName, const Uint32 bindingIndex) const
+{
+	_implementation->setUniformBlockBinding(blockName, bindingIndex);
+}
+
 void Effect::setUniformBlockBinding(const Uint32 blockIndex, const Uint32 bindingIndex) const
 {
 	_implementation->setUniformBlockBinding(blockIndex, bindingIndex);
 }
 
+const EffectUniformBlockList& Effect::uniformBlocks() const
+{
+	return _implementation->uniformBlocks();
+}
+
+const EffectUniformList& Effect::uniforms() const
+{
+	return _implementation->uniforms();
+}
+
 // Private
 
 Effect::Effect(GraphicsInterfaceHandle graphicsInterfaceHandle)
@@ -183,3 +530,83 @@ Effect::~Effect()
 {
 	DE_DELETE(_implementation, Implementation);
 }
+
+
+// External
+
+static UniformType getUniformType(const Uint32 typeId)
+{
+	switch(typeId)
+	{
+		case OpenGL::FLOAT:
+			return UniformType::Float32;
+
+		case OpenGL::FLOAT_MAT3:
+			return UniformType::Matrix3;
+
+		case OpenGL::FLOAT_MAT4:
+			return UniformType::Matrix4;
+
+		case OpenGL::FLOAT_VEC2:
+			return UniformType::Vector2;
+
+		case OpenGL::FLOAT_VEC3:
+			return UniformType::Vector3;
+
+		case OpenGL::FLOAT_VEC4:
+			return UniformType::Vector4;
+
+		case OpenGL::INT:
+			return UniformType::Int32;
+
+		case OpenGL::INT_SAMPLER_2D:
+		case OpenGL::INT_SAMPLER_2D_ARRAY:
+		case OpenGL::INT_SAMPLER_3D:
+		case OpenGL::INT_SAMPLER_BUFFER:
+		case OpenGL::INT_SAMPLER_CUBE:
+		case OpenGL::SAMPLER_1D:
+		case OpenGL::SAMPLER_2D:
+		case OpenGL::SAMPLER_2D_ARRAY:
+		case OpenGL::SAMPLER_2D_ARRAY_SHADOW:
+		case OpenGL::SAMPLER_2D_MULTISAMPLE:
+		case OpenGL::SAMPLER_2D_SHADOW:
+		case OpenGL::SAMPLER_3D:
+		case OpenGL::SAMPLER_BUFFER:
+		case OpenGL::SAMPLER_CUBE:
+		case OpenGL::SAMPLER_CUBE_SHADOW:
+		case OpenGL::UNSIGNED_INT_SAMPLER_2D:
+		case OpenGL::UNSIGNED_INT_SAMPLER_2D_ARRAY:
+		case OpenGL::UNSIGNED_INT_SAMPLER_3D:
+		case OpenGL::UNSIGNED_INT_SAMPLER_BUFFER:
+		case OpenGL::UNSIGNED_INT_SAMPLER_CUBE:
+			return UniformType::Sampler;
+
+		case OpenGL::UNSIGNED_INT:
+			return UniformType::Uint32;
+
+		default:
+			return UniformType::Other;
+	}
+}
+
+template<typename ProgramFunction, typename Function, typename... Parameters>
+static void setUniform(ProgramFunction programFunction, Function function, const Uint32 programHandle,
+	const Int32 location, Parameters... parameters)
+{
+	// Without separate shader objects the program has to be made current, so the previous one is restored for
+	// the graphics device
+
+	if(programFunction != nullptr)
+	{
+		programFunction(programHandle, location, parameters...);
+		DE_CHECK_ERROR_OPENGL();
+	}
+	else
+	{
+		OpenGL& openGl = OpenGL::instance();
+		const Uint32 previousProgramHandle = openGl.useProgramCustom(programHandle);
+		function(location, parameters...);
+		DE_CHECK_ERROR_OPENGL();
+		openGl.useProgramCustom(previousProgramHandle);
+	}
+}
@@ -21,10 +21,11 @@
 #include <core/FileStream.h>
 #include <core/Memory.h>
 #include <core/String.h>
+#include <core/StringView.h>
+#include <core/TokenStream.h>
 #include <core/Tokeniser.h>
 #include <core/Types.h>
 #include <core/Utility.h>
-#include <core/Vector.h>
 #include <graphics/EffectCode.h>
 #include <graphics/EffectSourceCodeReader.h>
 
@@ -47,43 +48,41 @@ public:
 
 	EffectCode* readCode(FileStream& fileStream)
 	{
-		Vector<Char8> data(fileStream.fileSize());
-		fileStream.read(reinterpret_cast<Uint8*>(data.data()), static_cast<Uint32>(data.size()));
-		const String8 tokenStream(data.data(), data.size());
-		Tokeniser tokeniser("\t\n!%&()*+,-./:;<=>?[]^{|}~");
-		const TokenList& tokens = tokeniser.tokenise(tokenStream);
-
+		const Tokeniser tokeniser("\t\n!%&()*+,-./:;<=>?[]^{|}~");
+		TokenStream tokenStream(tokeniser, fileStream);
 		Int32 indentation = 0;
 
-		for(TokenList::const_iterator i = tokens.begin(), end = tokens.end(); i != end; ++i)
+		for(TokenStream::Iterator i = tokenStream.begin(), end = tokenStream.end(); i != end; ++i)
 		{
-			if(i->lexeme[0] == '{')
+			const StringView8& lexeme = i->lexeme;
+
+			if(lexeme[0] == '{')
 			{
 				if(indentation > 0 && _activeShaderSource != nullptr)
-					_activeShaderSource->append(i->lexeme);
+					_activeShaderSource->append(lexeme.data(), lexeme.size());
 
 				++indentation;
 			}
-			else if(i->lexeme[0] == '}')
+			else if(lexeme[0] == '}')
 			{
 				--indentation;
 
 				if(indentation == 0)
 					_activeShaderSource = nullptr;
 				else if(_activeShaderSource != nullptr)
-					_activeShaderSource->append(i->lexeme);
+					_activeShaderSource->append(lexeme.data(), lexeme.size());
 			}
-			else if(i->lexeme == "VertexShader")
+			else if(lexeme == "VertexShader")
 			{
 				_activeShaderSource = &_vertexShaderSource;
 			}
-			else if(i->lexeme == "FragmentShader")
+			else if(lexeme == "FragmentShader")
 			{
 				_activeShaderSource = &_fragmentShaderSource;
 			}
 			else if(_activeShaderSource != nullptr)
 			{
-				_activeShaderSource->append(i->lexeme);
+				_activeShaderSource->append(lexeme.data(), lexeme.size());
 			}
 		}
 
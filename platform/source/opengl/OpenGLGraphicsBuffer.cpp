@@ -32,34 +32,26 @@ GraphicsBuffer::Implementation::Implementation(GraphicsInterfaceHandle graphicsI
 	const BufferBinding& binding, const Uint size, const AccessMode& accessMode, const BufferUsage& usage)
 	: Base(graphicsInterfaceHandle, binding, size, accessMode)
 {
-	bind();
+	bindForEditing();
 	initialiseStorage(accessMode, usage);
-
-#if DE_BUILD == DE_BUILD_DEBUG
-	debind();
-#endif
 }
 
 void GraphicsBuffer::Implementation::demapData() const
 {
-	bind();
+	bindForEditing();
 	Base::demapData();
-
-#if DE_BUILD == DE_BUILD_DEBUG
-	debind();
-#endif
 }
 
-Uint8* GraphicsBuffer::Implementation::mapData(const Uint size, const Uint offset) const
+void GraphicsBuffer::Implementation::flushMappedRange(const Uint size, const Uint offset) const
 {
-	bind();
-	Uint8* data = Base::mapData(size, offset);
-
-#if DE_BUILD == DE_BUILD_DEBUG
-	debind();
-#endif
+	bindForEditing();
+	Base::flushMappedRange(size, offset);
+}
 
-	return data;
+Uint8* GraphicsBuffer::Implementation::mapData(const Uint size, const Uint offset, const MapMode& mapMode) const
+{
+	bindForEditing();
+	return Base::mapData(size, offset, mapMode);
 }
 
 
@@ -72,6 +64,11 @@ void GraphicsBuffer::demapData() const
 	_implementation->demapData();
 }
 
+void GraphicsBuffer::flushMappedRange(const Uint size, const Uint offset) const
+{
+	_implementation->flushMappedRange(size, offset);
+}
+
 Uint8* GraphicsBuffer::mapData() const
 {
 	return _implementation->mapData();
@@ -79,7 +76,12 @@ Uint8* GraphicsBuffer::mapData() const
 
 Uint8* GraphicsBuffer::mapData(const Uint size, const Uint bufferOffset) const
 {
-	return _implementation->mapData(size, bufferOffset);
+	return _implementation->mapData(size, bufferOffset, MapMode::Default);
+}
+
+Uint8* GraphicsBuffer::mapData(const Uint size, const Uint bufferOffset, const MapMode& mapMode) const
+{
+	return _implementation->mapData(size, bufferOffset, mapMode);
 }
 
 // Private
@@ -20,7 +20,9 @@
 
 #include <core/Error.h>
 #include <core/Log.h>
+#include <core/debug/Assert.h>
 #include <graphics/AccessMode.h>
+#include <graphics/MapMode.h>
 #include <platform/opengl/OpenGL.h>
 #include <platform/opengl/OpenGLGraphicsBufferBase.h>
 
@@ -49,13 +51,18 @@ GraphicsBufferBase::GraphicsBufferBase(GraphicsInterfaceHandle graphicsInterface
 
 GraphicsBufferBase::~GraphicsBufferBase()
 {
-	OpenGL::deleteBuffers(1, &_bufferHandle);
-	DE_CHECK_ERROR_OPENGL();
+	_openGl->deleteBufferCustom(_bufferHandle);
 }
 
 void GraphicsBufferBase::demapData() const
 {
-	const Uint32 result = OpenGL::unmapBuffer(_binding >> 4);
+	Uint32 result;
+
+	if(_openGl->hasDirectStateAccess())
+		result = OpenGL::unmapNamedBuffer(_bufferHandle);
+	else
+		result = OpenGL::unmapBuffer(_binding >> 4);
+
 	DE_CHECK_ERROR_OPENGL();
 
 	if(result == 0u)
@@ -67,9 +74,31 @@ void GraphicsBufferBase::demapData() const
 	}
 }
 
-Uint8* GraphicsBufferBase::mapData(const Uint size, const Uint bufferOffset) const
+void GraphicsBufferBase::flushMappedRange(const Uint size, const Uint offset) const
+{
+	if(_openGl->hasDirectStateAccess())
+		OpenGL::flushMappedNamedBufferRange(_bufferHandle, offset, size);
+	else
+		OpenGL::flushMappedBufferRange(_binding >> 4, offset, size);
+
+	DE_CHECK_ERROR_OPENGL();
+}
+
+Uint8* GraphicsBufferBase::mapData(const Uint size, const Uint bufferOffset, const MapMode& mapMode) const
 {
-	Void* data = OpenGL::mapBufferRange(_binding >> 4, bufferOffset, size, _flags);
+	const Uint32 mapFlags = getMapFlags(mapMode);
+	DE_ASSERT(mapFlags == 0u || (_flags & OpenGL::MAP_WRITE_BIT) != 0u);
+
+	DE_ASSERT((mapFlags & ~OpenGL::MAP_FLUSH_EXPLICIT_BIT) == 0u ||
+		(_flags & OpenGL::MAP_READ_BIT) == 0u);
+
+	Void* data;
+
+	if(_openGl->hasDirectStateAccess())
+		data = OpenGL::mapNamedBufferRange(_bufferHandle, bufferOffset, size, _flags | mapFlags);
+	else
+		data = OpenGL::mapBufferRange(_binding >> 4, bufferOffset, size, _flags | mapFlags);
+
 	DE_CHECK_ERROR_OPENGL();
 
 	if(data == nullptr)
@@ -85,8 +114,15 @@ Uint8* GraphicsBufferBase::mapData(const Uint size, const Uint bufferOffset) con
 
 void GraphicsBufferBase::initialiseStorage(const AccessMode& accessMode, const BufferUsage& usage) const
 {
+	// Mutable storage keeps the usage hint and allows orphaning on either path
+
 	const Uint32 usageId = getUsageId(accessMode, usage);
-	OpenGL::bufferData(_binding >> 4, _size, nullptr, usageId);
+
+	if(_openGl->hasDirectStateAccess())
+		OpenGL::namedBufferData(_bufferHandle, _size, nullptr, usageId);
+	else
+		OpenGL::bufferData(_binding >> 4, _size, nullptr, usageId);
+
 	DE_CHECK_ERROR_OPENGL();
 }
 
@@ -103,12 +139,35 @@ void GraphicsBufferBase::initialiseAccessMode(const AccessMode& accessMode)
 
 void GraphicsBufferBase::createBuffer()
 {
-	OpenGL::genBuffers(1, &_bufferHandle);
+	if(_openGl->hasDirectStateAccess())
+		OpenGL::createBuffers(1, &_bufferHandle);
+	else
+		OpenGL::genBuffers(1, &_bufferHandle);
+
 	DE_CHECK_ERROR_OPENGL();
 }
 
 // Static
 
+Uint32 GraphicsBufferBase::getMapFlags(const MapMode& mapMode)
+{
+	Uint32 flags = 0u;
+
+	if((mapMode & MapMode::ExplicitFlush) == MapMode::ExplicitFlush)
+		flags |= OpenGL::MAP_FLUSH_EXPLICIT_BIT;
+
+	if((mapMode & MapMode::InvalidateBuffer) == MapMode::InvalidateBuffer)
+		flags |= OpenGL::MAP_INVALIDATE_BUFFER_BIT;
+
+	if((mapMode & MapMode::InvalidateRange) == MapMode::InvalidateRange)
+		flags |= OpenGL::MAP_INVALIDATE_RANGE_BIT;
+
+	if((mapMode & MapMode::Unsynchronised) == MapMode::Unsynchronised)
+		flags |= OpenGL::MAP_UNSYNCHRONIZED_BIT;
+
+	return flags;
+}
+
 Uint32 GraphicsBufferBase::getUsageId(const AccessMode& accessMode, const BufferUsage& usage)
 {
 	Uint32 id = static_cast<Uint32>(usage);
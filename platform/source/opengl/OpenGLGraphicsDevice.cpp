@@ -19,18 +19,25 @@
  */
 
 #include <core/Bitset.h>
+#include <core/Error.h>
+#include <core/Hash.h>
+#include <core/Log.h>
 #include <core/Memory.h>
 #include <core/Platform.h>
 #include <core/Rectangle.h>
 #include <core/Utility.h>
 #include <core/debug/Assert.h>
 #include <graphics/Colour.h>
+#include <graphics/DrawIndirectCommand.h>
 #include <graphics/Effect.h>
 #include <graphics/EffectCode.h>
 #include <graphics/GraphicsBuffer.h>
 #include <graphics/GraphicsDevice.h>
 #include <graphics/IndexBuffer.h>
+#include <graphics/Profiler.h>
 #include <graphics/Shader.h>
+#include <graphics/StateStatistics.h>
+#include <graphics/StreamingBuffer.h>
 #include <graphics/VertexBufferState.h>
 #include <graphics/Viewport.h>
 #include <platform/GraphicsContext.h>
@@ -38,12 +45,20 @@
 #include <platform/opengl/OpenGLEffect.h>
 #include <platform/opengl/OpenGLGraphicsBuffer.h>
 #include <platform/opengl/OpenGLGraphicsEnumerations.h>
+#include <platform/opengl/OpenGLStreamingBuffer.h>
 #include <platform/opengl/OpenGLVertexBufferState.h>
 
 using namespace Core;
 using namespace Graphics;
 using namespace Platform;
 
+// External
+
+static const Char8* COMPONENT_TAG = "[Graphics::GraphicsDevice - OpenGL] ";
+
+static Uint64 hashEffectCode(const EffectCode& effectCode);
+
+
 // Implementation
 
 class GraphicsDevice::Implementation final
@@ -51,7 +66,8 @@ class GraphicsDevice::Implementation final
 public:
 
 	explicit Implementation(GraphicsContext* graphicsContext)
-		: _activeEffect(nullptr),
+		: _stateStatistics(),
+		  _activeEffect(nullptr),
 		  _activeVertexBufferState(nullptr),
 		  _graphicsContext(graphicsContext),
 		  _openGl(nullptr)
@@ -71,9 +87,18 @@ public:
 
 	void bindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex) const
 	{
-		const Uint32 bindingId = static_cast<Uint32>(buffer->_implementation->binding()) >> 4;
-		OpenGL::bindBufferBase(bindingId, bindingIndex, buffer->_implementation->handle());
-		DE_CHECK_ERROR_OPENGL();
+		const Uint32 binding = static_cast<Uint32>(buffer->_implementation->binding());
+		_openGl->bindBufferBaseCustom(binding, bindingIndex, buffer->_implementation->handle());
+	}
+
+	void bindBufferRange(StreamingBuffer* buffer, const Uint32 bindingIndex,
+		const StreamingAllocation& allocation) const
+	{
+		const Uint32 binding = static_cast<Uint32>(buffer->_implementation->binding());
+		buffer->_implementation->upload(allocation);
+
+		_openGl->bindBufferRangeCustom(binding, bindingIndex, buffer->_implementation->handle(), allocation.offset,
+			allocation.size);
 	}
 
 	void clear(const Colour& colour) const
@@ -105,6 +130,16 @@ public:
 		return DE_NEW(Shader)(nullptr, type, shaderCode);
 	}
 
+	Profiler* createProfiler() const
+	{
+		return DE_NEW(Profiler)(_openGl);
+	}
+
+	StreamingBuffer* createStreamingBuffer(const BufferBinding& binding, const Uint frameSize) const
+	{
+		return DE_NEW(StreamingBuffer)(_openGl, binding, frameSize);
+	}
+
 	VertexBufferState* createVertexBufferState() const
 	{
 		return DE_NEW(VertexBufferState)(_openGl);
@@ -112,9 +147,8 @@ public:
 
 	void debindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bindingIndex) const
 	{
-		const Uint32 bindingId = static_cast<Uint32>(buffer->_implementation->binding()) >> 4;
-		OpenGL::bindBufferBase(bindingId, bindingIndex, 0u);
-		DE_CHECK_ERROR_OPENGL();
+		const Uint32 binding = static_cast<Uint32>(buffer->_implementation->binding());
+		_openGl->bindBufferBaseCustom(binding, bindingIndex, 0u);
 	}
 
 	void draw(const PrimitiveType& primitiveType, const Uint32 vertexCount, const Uint32 vertexOffset)
@@ -122,28 +156,140 @@ public:
 		initialiseDrawing();
 		OpenGL::drawArrays(static_cast<Uint32>(primitiveType), vertexOffset, vertexCount);
 		DE_CHECK_ERROR_OPENGL();
-
-#if DE_BUILD == DE_BUILD_DEBUG
-		deinitialiseDrawing();
-#endif
 	}
 
 	void drawIndexed(const PrimitiveType& primitiveType, const Uint32 indexCount, const Uint32 indexOffset)
 	{
 		initialiseDrawing();
-		IndexBuffer* indexBuffer = _activeVertexBufferState->_implementation->indexBuffer();
-		DE_ASSERT(indexBuffer != nullptr);
-		const Uint32 indexTypeId = static_cast<Uint32>(indexBuffer->indexType());
+		const Uint32 indexTypeId = getActiveIndexTypeId();
 		const Uint byteOffset = indexOffset * ((indexTypeId & 0x03) + 1u);
 
 		OpenGL::drawElements(static_cast<Uint32>(primitiveType), indexCount, indexTypeId >> 2,
 			reinterpret_cast<Void*>(byteOffset));
 
 		DE_CHECK_ERROR_OPENGL();
+	}
+
+	void drawIndexedInstanced(const PrimitiveType& primitiveType, const Uint32 indexCount,
+		const Uint32 instanceCount, const Uint32 indexOffset, const Int32 vertexOffset, const Uint32 instanceOffset)
+	{
+		initialiseDrawing();
+		const Uint32 indexTypeId = getActiveIndexTypeId();
+		const Uint byteOffset = indexOffset * ((indexTypeId & 0x03) + 1u);
+
+		if(instanceOffset == 0u)
+		{
+			OpenGL::drawElementsInstancedBaseVertex(static_cast<Uint32>(primitiveType), indexCount,
+				indexTypeId >> 2, reinterpret_cast<Void*>(byteOffset), instanceCount, vertexOffset);
+		}
+		else
+		{
+			if(OpenGL::drawElementsInstancedBaseVertexBaseInstance == nullptr)
+			{
+				defaultLog << LogLevel::Error << ::COMPONENT_TAG <<
+					"Failed to draw. A non-zero instance offset requires OpenGL 4.2." << Log::Flush();
+
+				DE_ERROR(0x0);
+			}
+
+			OpenGL::drawElementsInstancedBaseVertexBaseInstance(static_cast<Uint32>(primitiveType), indexCount,
+				indexTypeId >> 2, reinterpret_cast<Void*>(byteOffset), instanceCount, vertexOffset, instanceOffset);
+		}
+
+		DE_CHECK_ERROR_OPENGL();
+	}
+
+	void drawInstanced(const PrimitiveType& primitiveType, const Uint32 vertexCount, const Uint32 instanceCount,
+		const Uint32 vertexOffset, const Uint32 instanceOffset)
+	{
+		initialiseDrawing();
+
+		if(instanceOffset == 0u)
+		{
+			OpenGL::drawArraysInstanced(static_cast<Uint32>(primitiveType), vertexOffset, vertexCount,
+				instanceCount);
+		}
+		else
+		{
+			if(OpenGL::drawArraysInstancedBaseInstance == nullptr)
+			{
+				defaultLog << LogLevel::Error << ::COMPONENT_TAG <<
+					"Failed to draw. A non-zero instance offset requires OpenGL 4.2." << Log::Flush();
+
+				DE_ERROR(0x0);
+			}
+
+			OpenGL::drawArraysInstancedBaseInstance(static_cast<Uint32>(primitiveType), vertexOffset, vertexCount,
+				instanceCount, instanceOffset);
+		}
+
+		DE_CHECK_ERROR_OPENGL();
+	}
+
+	void multiDrawIndexedIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer,
+		const Uint32 drawCount, const Uint bufferOffset)
+	{
+		initialiseDrawing();
+		bindIndirectBuffer(buffer);
+		const Uint32 indexType = getActiveIndexTypeId() >> 2;
+
+		if(OpenGL::multiDrawElementsIndirect != nullptr)
+		{
+			OpenGL::multiDrawElementsIndirect(static_cast<Uint32>(primitiveType), indexType,
+				reinterpret_cast<Void*>(bufferOffset), drawCount, 0);
+
+			DE_CHECK_ERROR_OPENGL();
+			return;
+		}
+
+		if(OpenGL::drawElementsIndirect == nullptr)
+		{
+			defaultLog << LogLevel::Error << ::COMPONENT_TAG <<
+				"Failed to draw. Indirect drawing requires OpenGL 4.0." << Log::Flush();
+
+			DE_ERROR(0x0);
+		}
 
-#if DE_BUILD == DE_BUILD_DEBUG
-		deinitialiseDrawing();
-#endif
+		for(Uint32 i = 0u; i < drawCount; ++i)
+		{
+			const Uint commandOffset = bufferOffset + i * sizeof(DrawIndexedIndirectCommand);
+
+			OpenGL::drawElementsIndirect(static_cast<Uint32>(primitiveType), indexType,
+				reinterpret_cast<Void*>(commandOffset));
+
+			DE_CHECK_ERROR_OPENGL();
+		}
+	}
+
+	void multiDrawIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer, const Uint32 drawCount,
+		const Uint bufferOffset)
+	{
+		initialiseDrawing();
+		bindIndirectBuffer(buffer);
+
+		if(OpenGL::multiDrawArraysIndirect != nullptr)
+		{
+			OpenGL::multiDrawArraysIndirect(static_cast<Uint32>(primitiveType),
+				reinterpret_cast<Void*>(bufferOffset), drawCount, 0);
+
+			DE_CHECK_ERROR_OPENGL();
+			return;
+		}
+
+		if(OpenGL::drawArraysIndirect == nullptr)
+		{
+			defaultLog << LogLevel::Error << ::COMPONENT_TAG <<
+				"Failed to draw. Indirect drawing requires OpenGL 4.0." << Log::Flush();
+
+			DE_ERROR(0x0);
+		}
+
+		for(Uint32 i = 0u; i < drawCount; ++i)
+		{
+			const Uint commandOffset = bufferOffset + i * sizeof(DrawIndirectCommand);
+			OpenGL::drawArraysIndirect(static_cast<Uint32>(primitiveType), reinterpret_cast<Void*>(commandOffset));
+			DE_CHECK_ERROR_OPENGL();
+		}
 	}
 
 	void setEffect(Effect* effect)
@@ -152,6 +298,11 @@ public:
 		setComponentState(ComponentID::Effect, false);
 	}
 
+	void setErrorCheckMode(const ErrorCheckMode& errorCheckMode) const
+	{
+		_openGl->setErrorCheckMode(errorCheckMode);
+	}
+
 	void setVertexBufferState(VertexBufferState* vertexBufferState)
 	{
 		_activeVertexBufferState = vertexBufferState;
@@ -164,9 +315,17 @@ public:
 		setComponentState(ComponentID::Viewport, false);
 	}
 
-	void swapBuffers() const
+	const StateStatistics& stateStatistics() const
+	{
+		return _stateStatistics;
+	}
+
+	void swapBuffers()
 	{
 		_graphicsContext->swapBuffers();
+		_openGl->logDebugMessages();
+		_stateStatistics = _openGl->stateStatistics();
+		_openGl->resetStateStatistics();
 	}
 
 	const Viewport& viewport() const
@@ -187,6 +346,7 @@ private:
 	};
 
 	Viewport _viewport;
+	StateStatistics _stateStatistics;
 	Effect* _activeEffect;
 	VertexBufferState* _activeVertexBufferState;
 	GraphicsContext* _graphicsContext;
@@ -223,12 +383,21 @@ private:
 			initialiseViewportForDrawing();
 	}
 
-	void deinitialiseDrawing()
+	void bindIndirectBuffer(GraphicsBuffer* buffer) const
 	{
-		_activeVertexBufferState->_implementation->debind(0u);
-		setComponentState(ComponentID::VertexBufferState, false);
-		bindEffect(0u);
-		setComponentState(ComponentID::Effect, false);
+		DE_ASSERT(buffer != nullptr);
+		DE_ASSERT(buffer->_implementation->binding() == BufferBinding::Indirect);
+
+		_openGl->bindGraphicsBuffer(static_cast<Uint32>(BufferBinding::Indirect),
+			buffer->_implementation->handle());
+	}
+
+	Uint32 getActiveIndexTypeId() const
+	{
+		IndexBuffer* indexBuffer = _activeVertexBufferState->_implementation->indexBuffer();
+		DE_ASSERT(indexBuffer != nullptr);
+
+		return static_cast<Uint32>(indexBuffer->indexType());
 	}
 
 	void setComponentState(const ComponentID& componentId, const Bool isUpToDate)
@@ -243,8 +412,8 @@ private:
 
 	void initialiseEffectForDrawing()
 	{
-		const Uint32 programHandle = _activeEffect->_implementation->handle();
-		bindEffect(programHandle);
+		_activeEffect->_implementation->finaliseLink();
+		_openGl->useProgramCustom(_activeEffect->_implementation->handle());
 		setComponentState(ComponentID::Effect, true);
 	}
 
@@ -257,16 +426,9 @@ private:
 	void initialiseViewportForDrawing()
 	{
 		const Rectangle& bounds = _viewport.bounds();
-		OpenGL::viewport(bounds.x, bounds.y, bounds.width, bounds.height);
-		DE_CHECK_ERROR_OPENGL();
+		_openGl->viewportCustom(bounds.x, bounds.y, bounds.width, bounds.height);
 		setComponentState(ComponentID::Viewport, true);
 	}
-
-	static void bindEffect(const Uint32 programHandle)
-	{
-		OpenGL::useProgram(programHandle);
-		DE_CHECK_ERROR_OPENGL();
-	}
 };
 
 
@@ -279,6 +441,12 @@ void GraphicsDevice::bindBufferIndexed(GraphicsBuffer* buffer, const Uint32 bind
 	_implementation->bindBufferIndexed(buffer, bindingIndex);
 }
 
+void GraphicsDevice::bindBufferRange(StreamingBuffer* buffer, const Uint32 bindingIndex,
+	const StreamingAllocation& allocation) const
+{
+	_implementation->bindBufferRange(buffer, bindingIndex, allocation);
+}
+
 void GraphicsDevice::clear(const Colour& colour) const
 {
 	_implementation->clear(colour);
@@ -296,17 +464,29 @@ GraphicsBuffer* GraphicsDevice::createBuffer(const BufferBinding& binding, const
 
 Effect* GraphicsDevice::createEffect(EffectCode* effectCode)
 {
-	Shader* vertexShader = _implementation->createShader(ShaderType::Vertex, effectCode->vertexShaderCode());
+	Effect* effect = createEffectAsync(effectCode);
+	effect->_implementation->finaliseLink();
 
-	Shader* fragmentShader =
-		_implementation->createShader(ShaderType::Fragment, effectCode->fragmentShaderCode());
+	return effect;
+}
 
+Effect* GraphicsDevice::createEffectAsync(EffectCode* effectCode)
+{
 	Effect* effect = _implementation->createEffect();
-	effect->_implementation->attachShader(vertexShader);
-	effect->_implementation->attachShader(fragmentShader);
-	effect->_implementation->link();
-	DE_DELETE(fragmentShader, Shader);
-	DE_DELETE(vertexShader, Shader);
+	const Uint64 sourceHash = ::hashEffectCode(*effectCode);
+
+	if(!effect->_implementation->loadBinary(sourceHash))
+	{
+		Shader* vertexShader = _implementation->createShader(ShaderType::Vertex, effectCode->vertexShaderCode());
+
+		Shader* fragmentShader =
+			_implementation->createShader(ShaderType::Fragment, effectCode->fragmentShaderCode());
+
+		effect->_implementation->attachShader(vertexShader);
+		effect->_implementation->attachShader(fragmentShader);
+		effect->_implementation->link(sourceHash);
+	}
+
 	_resources.push_back(effect);
 
 	return effect;
@@ -321,6 +501,22 @@ IndexBuffer* GraphicsDevice::createIndexBuffer(const Uint size, const IndexType&
 	return indexBuffer;
 }
 
+Profiler* GraphicsDevice::createProfiler()
+{
+	Profiler* profiler = _implementation->createProfiler();
+	_resources.push_back(profiler);
+
+	return profiler;
+}
+
+StreamingBuffer* GraphicsDevice::createStreamingBuffer(const BufferBinding& binding, const Uint frameSize)
+{
+	StreamingBuffer* streamingBuffer = _implementation->createStreamingBuffer(binding, frameSize);
+	_resources.push_back(streamingBuffer);
+
+	return streamingBuffer;
+}
+
 VertexBufferState* GraphicsDevice::createVertexBufferState()
 {
 	VertexBufferState* vertexBufferState = _implementation->createVertexBufferState();
@@ -346,11 +542,41 @@ void GraphicsDevice::drawIndexed(const PrimitiveType& primitiveType, const Uint3
 	_implementation->drawIndexed(primitiveType, indexCount, indexOffset);
 }
 
+void GraphicsDevice::drawIndexedInstanced(const PrimitiveType& primitiveType, const Uint32 indexCount,
+	const Uint32 instanceCount, const Uint32 indexOffset, const Int32 vertexOffset, const Uint32 instanceOffset) const
+{
+	_implementation->drawIndexedInstanced(primitiveType, indexCount, instanceCount, indexOffset, vertexOffset,
+		instanceOffset);
+}
+
+void GraphicsDevice::drawInstanced(const PrimitiveType& primitiveType, const Uint32 vertexCount,
+	const Uint32 instanceCount, const Uint32 vertexOffset, const Uint32 instanceOffset) const
+{
+	_implementation->drawInstanced(primitiveType, vertexCount, instanceCount, vertexOffset, instanceOffset);
+}
+
+void GraphicsDevice::multiDrawIndexedIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer,
+	const Uint32 drawCount, const Uint bufferOffset) const
+{
+	_implementation->multiDrawIndexedIndirect(primitiveType, buffer, drawCount, bufferOffset);
+}
+
+void GraphicsDevice::multiDrawIndirect(const PrimitiveType& primitiveType, GraphicsBuffer* buffer,
+	const Uint32 drawCount, const Uint bufferOffset) const
+{
+	_implementation->multiDrawIndirect(primitiveType, buffer, drawCount, bufferOffset);
+}
+
 void GraphicsDevice::setEffect(Effect* effect) const
 {
 	_implementation->setEffect(effect);
 }
 
+void GraphicsDevice::setErrorCheckMode(const ErrorCheckMode& errorCheckMode) const
+{
+	_implementation->setErrorCheckMode(errorCheckMode);
+}
+
 void GraphicsDevice::setVertexBufferState(VertexBufferState* vertexBufferState) const
 {
 	_implementation->setVertexBufferState(vertexBufferState);
@@ -366,6 +592,11 @@ const Viewport& GraphicsDevice::viewport() const
 	return _implementation->viewport();
 }
 
+const StateStatistics& GraphicsDevice::stateStatistics() const
+{
+	return _implementation->stateStatistics();
+}
+
 void GraphicsDevice::swapBuffers() const
 {
 	_implementation->swapBuffers();
@@ -384,3 +615,15 @@ GraphicsDevice::~GraphicsDevice()
 	destroyResources();
 	DE_DELETE(_implementation, Implementation);
 }
+
+
+// External
+
+static Uint64 hashEffectCode(const EffectCode& effectCode)
+{
+	const ByteList& vertexShaderCode = effectCode.vertexShaderCode();
+	const ByteList& fragmentShaderCode = effectCode.fragmentShaderCode();
+	const Uint64 vertexShaderHash = hashBytes(vertexShaderCode.data(), vertexShaderCode.size());
+
+	return hashBytes(fragmentShaderCode.data(), fragmentShaderCode.size(), vertexShaderHash);
+}
@@ -47,10 +47,17 @@ void IndexBuffer::Implementation::demapData() const
 	debindFromDefaultVertexArray(previousVertexArrayHandle);
 }
 
-Uint8* IndexBuffer::Implementation::mapData(const Uint size, const Uint offset) const
+void IndexBuffer::Implementation::flushMappedRange(const Uint size, const Uint offset) const
 {
 	const Uint32 previousVertexArrayHandle = bindToDefaultVertexArray();
-	Uint8* data = Base::mapData(size, offset);
+	Base::flushMappedRange(size, offset);
+	debindFromDefaultVertexArray(previousVertexArrayHandle);
+}
+
+Uint8* IndexBuffer::Implementation::mapData(const Uint size, const Uint offset, const MapMode& mapMode) const
+{
+	const Uint32 previousVertexArrayHandle = bindToDefaultVertexArray();
+	Uint8* data = Base::mapData(size, offset, mapMode);
 	debindFromDefaultVertexArray(previousVertexArrayHandle);
 
 	return data;
@@ -60,6 +67,9 @@ Uint8* IndexBuffer::Implementation::mapData(const Uint size, const Uint offset)
 
 Uint32 IndexBuffer::Implementation::bindToDefaultVertexArray() const
 {
+	if(_openGl->hasDirectStateAccess())
+		return 0u;
+
 	const Uint32 previousVertexArrayHandle = _openGl->bindDefaultVertexArray();
 	bind();
 
@@ -68,9 +78,8 @@ Uint32 IndexBuffer::Implementation::bindToDefaultVertexArray() const
 
 void IndexBuffer::Implementation::debindFromDefaultVertexArray(const Uint32 previousVertexArrayHandle) const
 {
-#if DE_BUILD == DE_BUILD_DEBUG
-	debind();
-#endif
+	if(_openGl->hasDirectStateAccess())
+		return;
 
 	_openGl->bindVertexArrayCustom(previousVertexArrayHandle);
 }
@@ -91,6 +100,11 @@ void IndexBuffer::demapData() const
 	_implementation->demapData();
 }
 
+void IndexBuffer::flushMappedRange(const Uint size, const Uint offset) const
+{
+	_implementation->flushMappedRange(size, offset);
+}
+
 Uint8* IndexBuffer::mapData() const
 {
 	return _implementation->mapData();
@@ -98,7 +112,12 @@ Uint8* IndexBuffer::mapData() const
 
 Uint8* IndexBuffer::mapData(const Uint size, const Uint bufferOffset) const
 {
-	return _implementation->mapData(size, bufferOffset);
+	return _implementation->mapData(size, bufferOffset, MapMode::Default);
+}
+
+Uint8* IndexBuffer::mapData(const Uint size, const Uint bufferOffset, const MapMode& mapMode) const
+{
+	return _implementation->mapData(size, bufferOffset, mapMode);
 }
 
 // Private
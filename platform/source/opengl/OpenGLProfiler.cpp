@@ -0,0 +1,429 @@
+/**
+ * @file platform/opengl/OpenGLProfiler.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <core/FileStream.h>
+#include <core/Memory.h>
+#include <core/StringStream.h>
+#include <core/StringView.h>
+#include <core/debug/Assert.h>
+#include <platform/opengl/OpenGL.h>
+#include <platform/opengl/OpenGLProfiler.h>
+
+using namespace Core;
+using namespace Graphics;
+using namespace Platform;
+
+// External
+
+static const Char8* HEXADECIMAL_DIGITS = "0123456789ABCDEF";
+static const Float64 NANOSECONDS_PER_MICROSECOND = 1000.0;
+static const Float64 NANOSECONDS_PER_MILLISECOND = 1000000.0;
+
+static Int64 getSteadyClockTime();
+static void writeChromeTraceEvent(StringStream8& stream, const Name& name, const Char8* category, const Uint32 threadId,
+	const Int64 beginTime, const Int64 endTime, const Uint32 frameNumber);
+
+static void writeJsonString(StringStream8& stream, const StringView8& string);
+
+
+// Implementation
+
+// Public
+
+Profiler::Implementation::Implementation()
+	: _cpuEpoch(0),
+	  _gpuEpoch(0),
+	  _frameIndex(0u),
+	  _frameNumber(0u),
+	  _droppedFrameCount(0u),
+	  _hasGpuTiming(false)
+{
+	for(Uint32 i = 0u; i < FRAME_COUNT; ++i)
+	{
+		_frames[i].frameNumber = 0u;
+		_frames[i].lastQueryIndex = 0u;
+		_frames[i].isPending = false;
+	}
+
+	initialiseGpuTiming();
+}
+
+Profiler::Implementation::~Implementation()
+{
+	for(Uint32 i = 0u; i < FRAME_COUNT; ++i)
+	{
+		const QueryHandleList& queryHandles = _frames[i].queryHandles;
+
+		if(!queryHandles.empty())
+		{
+			OpenGL::deleteQueries(static_cast<Int32>(queryHandles.size()), queryHandles.data());
+			DE_CHECK_ERROR_OPENGL();
+		}
+	}
+}
+
+void Profiler::Implementation::beginScope(const Name& name)
+{
+	Frame& frame = _frames[_frameIndex];
+	const Uint32 queryIndex = 2u * static_cast<Uint32>(frame.scopes.size());
+	_openScopeIndices.push_back(static_cast<Uint32>(frame.scopes.size()));
+	frame.scopes.push_back({ name, getCpuTime(), 0, static_cast<Uint32>(_openScopeIndices.size() - 1u), queryIndex });
+	issueTimestamp(frame, queryIndex);
+}
+
+void Profiler::Implementation::endFrame()
+{
+	DE_ASSERT(_openScopeIndices.empty());
+	Frame& endedFrame = _frames[_frameIndex];
+	endedFrame.frameNumber = _frameNumber;
+	endedFrame.isPending = true;
+	_frameIndex = (_frameIndex + 1u) % FRAME_COUNT;
+	++_frameNumber;
+	resolveFrames();
+	Frame& frame = _frames[_frameIndex];
+
+	// Waiting for the oldest frame would stall the CPU, so its GPU times are dropped instead
+
+	if(frame.isPending)
+	{
+		resolveFrame(frame, false);
+		++_droppedFrameCount;
+	}
+
+	frame.scopes.clear();
+}
+
+void Profiler::Implementation::endScope()
+{
+	DE_ASSERT(!_openScopeIndices.empty());
+	Frame& frame = _frames[_frameIndex];
+	ScopeRecord& scope = frame.scopes[_openScopeIndices.back()];
+	_openScopeIndices.pop_back();
+	issueTimestamp(frame, scope.queryIndex + 1u);
+	scope.cpuEndTime = getCpuTime();
+}
+
+void Profiler::Implementation::exportChromeTrace(const String8& filepath) const
+{
+	StringStream8 stream;
+	stream << std::fixed << std::setprecision(3);
+
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+		"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n"
+		"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+
+	for(Vector<TraceEvent>::const_iterator i = _traceEvents.begin(), end = _traceEvents.end(); i != end; ++i)
+	{
+		::writeChromeTraceEvent(stream, i->name, "cpu", 1u, i->cpuBeginTime, i->cpuEndTime, i->frameNumber);
+
+		if(i->hasGpuTime)
+			::writeChromeTraceEvent(stream, i->name, "gpu", 2u, i->gpuBeginTime, i->gpuEndTime, i->frameNumber);
+	}
+
+	stream << "\n]}\n";
+	const String8 trace = stream.str();
+	const FileStream fileStream(filepath, OpenMode::Write | OpenMode::Truncate);
+	fileStream.write(reinterpret_cast<const Uint8*>(trace.data()), static_cast<Uint32>(trace.size()));
+}
+
+const ProfileStatistics* Profiler::Implementation::findStatistics(const Name& name) const
+{
+	const FlatMap<Name, Uint32>::const_iterator iterator = _statisticsIndices.find(name);
+
+	if(iterator == _statisticsIndices.end())
+		return nullptr;
+
+	return &_statistics[iterator->second];
+}
+
+// Private
+
+void Profiler::Implementation::initialiseGpuTiming()
+{
+	Int32 counterBits = 0;
+	OpenGL::getQueryiv(OpenGL::TIMESTAMP, OpenGL::QUERY_COUNTER_BITS, &counterBits);
+	DE_CHECK_ERROR_OPENGL();
+	_hasGpuTiming = counterBits > 0;
+	_cpuEpoch = ::getSteadyClockTime();
+
+	// The clocks are sampled together so that GPU times can be shown on the CPU timeline
+
+	if(_hasGpuTiming)
+	{
+		OpenGL::getInteger64v(OpenGL::TIMESTAMP, &_gpuEpoch);
+		DE_CHECK_ERROR_OPENGL();
+	}
+}
+
+Int64 Profiler::Implementation::getCpuTime() const
+{
+	return ::getSteadyClockTime() - _cpuEpoch;
+}
+
+void Profiler::Implementation::issueTimestamp(Frame& frame, const Uint32 queryIndex) const
+{
+	if(!_hasGpuTiming)
+		return;
+
+	if(queryIndex >= frame.queryHandles.size())
+	{
+		const Uint32 queryCount = static_cast<Uint32>(frame.queryHandles.size());
+		frame.queryHandles.resize(queryCount + 2u);
+		OpenGL::genQueries(2, frame.queryHandles.data() + queryCount);
+		DE_CHECK_ERROR_OPENGL();
+	}
+
+	OpenGL::queryCounter(frame.queryHandles[queryIndex], OpenGL::TIMESTAMP);
+	DE_CHECK_ERROR_OPENGL();
+	frame.lastQueryIndex = queryIndex;
+}
+
+Bool Profiler::Implementation::isFrameAvailable(const Frame& frame) const
+{
+	if(!_hasGpuTiming || frame.scopes.empty())
+		return true;
+
+	// The queries of a frame complete in issue order, so the last one tells whether all are available
+
+	Uint32 isAvailable = OpenGL::FALSE;
+	OpenGL::getQueryObjectuiv(frame.queryHandles[frame.lastQueryIndex], OpenGL::QUERY_RESULT_AVAILABLE, &isAvailable);
+	DE_CHECK_ERROR_OPENGL();
+
+	return isAvailable != OpenGL::FALSE;
+}
+
+void Profiler::Implementation::resolveFrames()
+{
+	// Frames are resolved from the oldest so that the trace stays in order
+
+	for(Uint32 i = 0u; i < FRAME_COUNT; ++i)
+	{
+		Frame& frame = _frames[(_frameIndex + i) % FRAME_COUNT];
+
+		if(frame.isPending)
+		{
+			if(!isFrameAvailable(frame))
+				break;
+
+			resolveFrame(frame, true);
+		}
+	}
+}
+
+void Profiler::Implementation::resolveFrame(Frame& frame, const Bool hasGpuTimes)
+{
+	const Bool hasGpuTime = _hasGpuTiming && hasGpuTimes;
+
+	for(ScopeRecordList::const_iterator i = frame.scopes.begin(), end = frame.scopes.end(); i != end; ++i)
+	{
+		TraceEvent traceEvent { i->name, i->cpuBeginTime, i->cpuEndTime, 0, 0, frame.frameNumber, hasGpuTime };
+
+		if(hasGpuTime)
+		{
+			traceEvent.gpuBeginTime = getGpuTime(frame, i->queryIndex);
+			traceEvent.gpuEndTime = getGpuTime(frame, i->queryIndex + 1u);
+		}
+
+		const Float64 cpuTime = static_cast<Float64>(i->cpuEndTime - i->cpuBeginTime) / ::NANOSECONDS_PER_MILLISECOND;
+
+		const Float64 gpuTime =
+			static_cast<Float64>(traceEvent.gpuEndTime - traceEvent.gpuBeginTime) / ::NANOSECONDS_PER_MILLISECOND;
+
+		addSamples(*i, cpuTime, gpuTime, hasGpuTime);
+		addTraceEvent(traceEvent);
+	}
+
+	frame.isPending = false;
+}
+
+Int64 Profiler::Implementation::getGpuTime(const Frame& frame, const Uint32 queryIndex) const
+{
+	Uint64 timestamp = 0u;
+	OpenGL::getQueryObjectui64v(frame.queryHandles[queryIndex], OpenGL::QUERY_RESULT, &timestamp);
+	DE_CHECK_ERROR_OPENGL();
+
+	return static_cast<Int64>(timestamp) - _gpuEpoch;
+}
+
+void Profiler::Implementation::addSamples(const ScopeRecord& scope, const Float64 cpuTime, const Float64 gpuTime,
+	const Bool hasGpuTime)
+{
+	const std::pair<FlatMap<Name, Uint32>::iterator, Bool> result =
+		_statisticsIndices.emplace(scope.name, static_cast<Uint32>(_statistics.size()));
+
+	if(result.second)
+	{
+		_statistics.push_back({ scope.name, scope.depth, 0u, 0u, 0.0, 0.0, 0.0, 0.0 });
+		_scopeSamples.push_back(ScopeSamples());
+		ScopeSamples& scopeSamples = _scopeSamples.back();
+		scopeSamples.cpuTimes.count = 0u;
+		scopeSamples.cpuTimes.nextIndex = 0u;
+		scopeSamples.gpuTimes.count = 0u;
+		scopeSamples.gpuTimes.nextIndex = 0u;
+	}
+
+	ProfileStatistics& statistics = _statistics[result.first->second];
+	ScopeSamples& scopeSamples = _scopeSamples[result.first->second];
+	statistics.depth = scope.depth;
+
+	addSample(scopeSamples.cpuTimes, cpuTime, statistics.cpuSampleCount, statistics.averageCpuTime,
+		statistics.maximumCpuTime);
+
+	if(hasGpuTime)
+	{
+		addSample(scopeSamples.gpuTimes, gpuTime, statistics.gpuSampleCount, statistics.averageGpuTime,
+			statistics.maximumGpuTime);
+	}
+}
+
+void Profiler::Implementation::addTraceEvent(const TraceEvent& traceEvent)
+{
+	// The oldest quarter is discarded at once to keep the erasing cost amortised
+
+	if(_traceEvents.size() == MAX_TRACE_EVENT_COUNT)
+		_traceEvents.erase(_traceEvents.begin(), _traceEvents.begin() + MAX_TRACE_EVENT_COUNT / 4u);
+
+	_traceEvents.push_back(traceEvent);
+}
+
+// Static
+
+void Profiler::Implementation::addSample(SampleWindow& window, const Float64 time, Uint32& sampleCount,
+	Float64& averageTime, Float64& maximumTime)
+{
+	// Copied, as std::min() would bind the class constant to a reference
+
+	const Uint32 windowSize = SAMPLE_COUNT;
+	window.times[window.nextIndex] = time;
+	window.nextIndex = (window.nextIndex + 1u) % windowSize;
+	window.count = std::min(window.count + 1u, windowSize);
+	Float64 timeSum = 0.0;
+	maximumTime = 0.0;
+
+	for(Uint32 i = 0u; i < window.count; ++i)
+	{
+		timeSum += window.times[i];
+		maximumTime = std::max(maximumTime, window.times[i]);
+	}
+
+	sampleCount = window.count;
+	averageTime = timeSum / window.count;
+}
+
+
+// Graphics::Profiler
+
+// Public
+
+void Profiler::beginScope(const Name& name) const
+{
+	_implementation->beginScope(name);
+}
+
+Uint32 Profiler::droppedFrameCount() const
+{
+	return _implementation->droppedFrameCount();
+}
+
+void Profiler::endFrame() const
+{
+	_implementation->endFrame();
+}
+
+void Profiler::endScope() const
+{
+	_implementation->endScope();
+}
+
+void Profiler::exportChromeTrace(const String8& filepath) const
+{
+	_implementation->exportChromeTrace(filepath);
+}
+
+const ProfileStatistics* Profiler::findStatistics(const Name& name) const
+{
+	return _implementation->findStatistics(name);
+}
+
+Bool Profiler::hasGpuTiming() const
+{
+	return _implementation->hasGpuTiming();
+}
+
+const ProfileStatisticsList& Profiler::statistics() const
+{
+	return _implementation->statistics();
+}
+
+// Private
+
+Profiler::Profiler(GraphicsInterfaceHandle graphicsInterfaceHandle)
+	: _implementation(nullptr)
+{
+	static_cast<Void>(graphicsInterfaceHandle);
+	_implementation = DE_NEW(Implementation)();
+}
+
+Profiler::~Profiler()
+{
+	DE_DELETE(_implementation, Implementation);
+}
+
+
+// External
+
+static Int64 getSteadyClockTime()
+{
+	const std::chrono::steady_clock::duration time = std::chrono::steady_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+}
+
+static void writeChromeTraceEvent(StringStream8& stream, const Name& name, const Char8* category, const Uint32 threadId,
+	const Int64 beginTime, const Int64 endTime, const Uint32 frameNumber)
+{
+	stream << ",\n{\"name\":";
+	::writeJsonString(stream, name.string());
+
+	stream << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId << ",\"ts\":" <<
+		beginTime / ::NANOSECONDS_PER_MICROSECOND << ",\"dur\":" <<
+		(endTime - beginTime) / ::NANOSECONDS_PER_MICROSECOND << ",\"args\":{\"frame\":" << frameNumber << "}}";
+}
+
+static void writeJsonString(StringStream8& stream, const StringView8& string)
+{
+	stream << '"';
+
+	for(const Char8* i = string.begin(), *end = string.end(); i != end; ++i)
+	{
+		const Uint8 character = static_cast<Uint8>(*i);
+
+		if(character == '"' || character == '\\')
+			stream << '\\' << *i;
+		else if(character < 0x20u)
+			stream << "\\u00" << ::HEXADECIMAL_DIGITS[character >> 4] << ::HEXADECIMAL_DIGITS[character & 0x0F];
+		else
+			stream << *i;
+	}
+
+	stream << '"';
+}
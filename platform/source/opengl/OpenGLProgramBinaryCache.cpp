@@ -0,0 +1,208 @@
+/**
+ * @file platform/opengl/OpenGLProgramBinaryCache.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <core/FileStream.h>
+#include <core/FileSystem.h>
+#include <core/Hash.h>
+#include <core/Log.h>
+#include <core/Utility.h>
+#include <platform/opengl/OpenGL.h>
+#include <platform/opengl/OpenGLProgramBinaryCache.h>
+
+using namespace Core;
+using namespace Platform;
+
+// External
+
+static const Char8* COMPONENT_TAG = "[Platform::ProgramBinaryCache - OpenGL] ";
+static const Uint32 FILE_IDENTIFIER = 0x42504544; // "DEPB"
+static const Uint32 FILE_VERSION = 1u;
+static const Char8* FILENAME_PREFIX = "program_";
+static const Char8* FILENAME_EXTENSION = ".bin";
+static const Char8* HEXADECIMAL_DIGITS = "0123456789abcdef";
+
+struct ProgramBinaryHeader final
+{
+	Uint32 identifier;
+	Uint32 version;
+	Uint32 binaryFormat;
+	Uint32 binarySize;
+	Uint64 driverHash;
+	Uint64 sourceHash;
+};
+
+static Uint64 hashString(const Uint32 name, const Uint64 seed);
+
+
+// Public
+
+ProgramBinaryCache::ProgramBinaryCache()
+	: _driverHash(0u),
+	  _isEnabled(false)
+{
+	if(OpenGL::programBinary != nullptr)
+	{
+		Int32 formatCount = 0;
+		OpenGL::getIntegerv(OpenGL::NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		DE_CHECK_ERROR_OPENGL();
+		_isEnabled = formatCount > 0;
+	}
+
+	if(_isEnabled)
+	{
+		_directory = FileSystem::getDefaultContentRootDirectory();
+		_driverHash = getDriverHash();
+
+		// Opening a file fails fatally, so an unwritable directory disables
+		// the cache up front
+
+		if(!FileSystem::isWritable(_directory.empty() ? String8(".") : _directory))
+			disable(_directory);
+	}
+}
+
+Bool ProgramBinaryCache::load(const Uint32 programHandle, const Uint64 sourceHash) const
+{
+	if(!_isEnabled)
+		return false;
+
+	const String8 filepath = getFilepath(sourceHash);
+
+	if(!FileSystem::isReadable(filepath))
+		return false;
+
+	const FileStream fileStream(filepath);
+	const Uint32 fileSize = fileStream.fileSize();
+	ProgramBinaryHeader header;
+
+	if(fileSize < sizeof(ProgramBinaryHeader) ||
+		fileStream.read(reinterpret_cast<Uint8*>(&header), sizeof(ProgramBinaryHeader)) !=
+			sizeof(ProgramBinaryHeader))
+	{
+		return false;
+	}
+
+	// An entry written by another driver is stale even if the driver would
+	// accept it
+
+	if(header.identifier != ::FILE_IDENTIFIER || header.version != ::FILE_VERSION ||
+		header.driverHash != _driverHash || header.sourceHash != sourceHash ||
+		header.binarySize != fileSize - sizeof(ProgramBinaryHeader))
+	{
+		return false;
+	}
+
+	ByteList binary(header.binarySize);
+
+	if(fileStream.read(binary.data(), header.binarySize) != header.binarySize)
+		return false;
+
+	OpenGL::programBinary(programHandle, header.binaryFormat, binary.data(), header.binarySize);
+	DE_CHECK_ERROR_OPENGL();
+	Int32 linkingStatus = OpenGL::FALSE;
+	OpenGL::getProgramiv(programHandle, OpenGL::LINK_STATUS, &linkingStatus);
+	DE_CHECK_ERROR_OPENGL();
+
+	return linkingStatus == OpenGL::TRUE;
+}
+
+void ProgramBinaryCache::store(const Uint32 programHandle, const Uint64 sourceHash)
+{
+	if(!_isEnabled)
+		return;
+
+	const String8 filepath = getFilepath(sourceHash);
+
+	if(FileSystem::fileExists(filepath) && !FileSystem::isWritable(filepath))
+	{
+		disable(filepath);
+		return;
+	}
+
+	Int32 binarySize = 0;
+	OpenGL::getProgramiv(programHandle, OpenGL::PROGRAM_BINARY_LENGTH, &binarySize);
+	DE_CHECK_ERROR_OPENGL();
+
+	if(binarySize <= 0)
+		return;
+
+	ByteList binary(binarySize);
+	Uint32 binaryFormat = 0u;
+	OpenGL::getProgramBinary(programHandle, binarySize, nullptr, &binaryFormat, binary.data());
+	DE_CHECK_ERROR_OPENGL();
+
+	const ProgramBinaryHeader header
+	{
+		::FILE_IDENTIFIER,
+		::FILE_VERSION,
+		binaryFormat,
+		static_cast<Uint32>(binarySize),
+		_driverHash,
+		sourceHash
+	};
+
+	const FileStream fileStream(filepath, OpenMode::Write | OpenMode::Truncate);
+	fileStream.write(reinterpret_cast<const Uint8*>(&header), sizeof(ProgramBinaryHeader));
+	fileStream.write(binary.data(), binary.size());
+}
+
+// Private
+
+void ProgramBinaryCache::disable(const String8& path)
+{
+	defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "'" << path <<
+		"' is not writable, the program binary cache is disabled." << Log::Flush();
+
+	_isEnabled = false;
+}
+
+String8 ProgramBinaryCache::getFilepath(const Uint64 sourceHash) const
+{
+	String8 filepath(_directory);
+	filepath.append(::FILENAME_PREFIX);
+
+	for(Int32 i = 60; i >= 0; i -= 4)
+		filepath.push_back(::HEXADECIMAL_DIGITS[(sourceHash >> i) & 0x0F]);
+
+	filepath.append(::FILENAME_EXTENSION);
+	return filepath;
+}
+
+// Static
+
+Uint64 ProgramBinaryCache::getDriverHash()
+{
+	Uint64 driverHash = ::hashString(OpenGL::VENDOR, 0u);
+	driverHash = ::hashString(OpenGL::RENDERER, driverHash);
+
+	return ::hashString(OpenGL::VERSION, driverHash);
+}
+
+
+// External
+
+static Uint64 hashString(const Uint32 name, const Uint64 seed)
+{
+	const Char8* string = reinterpret_cast<const Char8*>(OpenGL::getString(name));
+	DE_CHECK_ERROR_OPENGL();
+
+	return hashBytes(string, std::strlen(string), seed);
+}
@@ -56,7 +56,6 @@ Shader::Implementation::Implementation(const ShaderType& type, const ByteList& s
 {
 	createShader(type);
 	compileShader(reinterpret_cast<const Char8*>(shaderCode.data()));
-	checkCompilationStatus();
 }
 
 Shader::Implementation::~Implementation()
@@ -65,6 +64,21 @@ Shader::Implementation::~Implementation()
 	DE_CHECK_ERROR_OPENGL();
 }
 
+void Shader::Implementation::checkCompilationStatus() const
+{
+	const Int32 compilationStatus = getParameter(OpenGL::COMPILE_STATUS);
+
+	if(compilationStatus == OpenGL::FALSE)
+	{
+		outputCompilerFailureLog();
+		DE_ERROR(0x0);
+	}
+	else
+	{
+		outputCompilerSuccessLog();
+	}
+}
+
 // Private
 
 void Shader::Implementation::createShader(const ShaderType& type)
@@ -89,21 +103,6 @@ void Shader::Implementation::compileShader(const Char8* shaderSource) const
 	DE_CHECK_ERROR_OPENGL();
 }
 
-void Shader::Implementation::checkCompilationStatus() const
-{
-	const Int32 compilationStatus = getParameter(OpenGL::COMPILE_STATUS);
-
-	if(compilationStatus == OpenGL::FALSE)
-	{
-		outputCompilerFailureLog();
-		DE_ERROR(0x0);
-	}
-	else
-	{
-		outputCompilerSuccessLog();
-	}
-}
-
 Int32 Shader::Implementation::getParameter(const Uint32 parameterName) const
 {
 	Int32 parameter;
@@ -0,0 +1,240 @@
+/**
+ * @file platform/opengl/OpenGLStreamingBuffer.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Error.h>
+#include <core/Log.h>
+#include <core/Memory.h>
+#include <core/debug/Assert.h>
+#include <graphics/AccessMode.h>
+#include <platform/opengl/OpenGLGraphicsEnumerations.h>
+#include <platform/opengl/OpenGLStreamingBuffer.h>
+
+using namespace Core;
+using namespace Graphics;
+using namespace Platform;
+
+// External
+
+static const Char8* COMPONENT_TAG = "[Graphics::StreamingBuffer - OpenGL] ";
+static const Uint64 FENCE_WAIT_TIMEOUT = 1000000000u; // In nanoseconds
+static const Uint VERTEX_DATA_ALIGNMENT = 16u;
+
+static Uint alignOffset(const Uint offset, const Uint alignment);
+
+
+// Implementation
+
+// Public
+
+StreamingBuffer::Implementation::Implementation(GraphicsInterfaceHandle graphicsInterfaceHandle,
+	const BufferBinding& binding, const Uint frameSize)
+	: Base(graphicsInterfaceHandle, binding, 0u, AccessMode::Write),
+	  _data(nullptr),
+	  _frameSize(0u),
+	  _frameOffset(0u),
+	  _alignment(VERTEX_DATA_ALIGNMENT),
+	  _frameIndex(0u),
+	  _isPersistent(OpenGL::bufferStorage != nullptr)
+{
+	DE_ASSERT(binding != BufferBinding::Index);
+	_fences.fill(nullptr);
+
+	if(binding == BufferBinding::Uniform)
+		_alignment = _openGl->uniformBufferOffsetAlignment();
+
+	_frameSize = ::alignOffset(frameSize, _alignment);
+	_size = _frameSize * FRAME_COUNT;
+	initialiseStorage();
+}
+
+StreamingBuffer::Implementation::~Implementation()
+{
+	for(Uint32 i = 0u; i < FRAME_COUNT; ++i)
+	{
+		if(_fences[i] != nullptr)
+		{
+			OpenGL::deleteSync(_fences[i]);
+			DE_CHECK_ERROR_OPENGL();
+		}
+	}
+
+	if(!_isPersistent)
+	{
+		DE_DELETE_ARRAY(_data, Uint8, _size);
+		return;
+	}
+
+	if(!_openGl->hasDirectStateAccess())
+		_openGl->bindGraphicsBuffer(_binding, _bufferHandle);
+
+	Base::demapData();
+}
+
+StreamingAllocation StreamingBuffer::Implementation::allocate(const Uint size)
+{
+	const Uint offset = ::alignOffset(_frameOffset, _alignment);
+
+	if(offset + size > _frameSize)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to allocate " << size <<
+			" bytes. The frame size of " << _frameSize << " bytes was exceeded." << Log::Flush();
+
+		DE_ERROR(0x0);
+	}
+
+	_frameOffset = offset + size;
+	const Uint bufferOffset = _frameIndex * _frameSize + offset;
+
+	return { _data + bufferOffset, bufferOffset, size };
+}
+
+void StreamingBuffer::Implementation::endFrame()
+{
+	// Uploads are ordered by the driver, so only the mapped storage needs fences
+
+	if(_isPersistent)
+	{
+		_fences[_frameIndex] = OpenGL::fenceSync(OpenGL::SYNC_GPU_COMMANDS_COMPLETE, 0u);
+		DE_CHECK_ERROR_OPENGL();
+	}
+
+	_frameIndex = (_frameIndex + 1u) % FRAME_COUNT;
+	_frameOffset = 0u;
+	waitForFence(_frameIndex);
+}
+
+void StreamingBuffer::Implementation::upload(const StreamingAllocation& allocation)
+{
+	if(_isPersistent)
+		return;
+
+	_openGl->bindGraphicsBuffer(_binding, _bufferHandle);
+	OpenGL::bufferSubData(_binding >> 4, allocation.offset, allocation.size, allocation.data);
+	DE_CHECK_ERROR_OPENGL();
+}
+
+// Private
+
+void StreamingBuffer::Implementation::initialiseStorage()
+{
+	if(!_isPersistent)
+	{
+		// Persistent mapping requires OpenGL 4.4, so the frames are staged in
+		// system memory instead
+
+		_openGl->bindGraphicsBuffer(_binding, _bufferHandle);
+		Base::initialiseStorage(AccessMode::Write, BufferUsage::Stream);
+		_data = DE_NEW_ARRAY(Uint8, _size);
+		return;
+	}
+
+	const Uint32 flags = OpenGL::MAP_WRITE_BIT | OpenGL::MAP_PERSISTENT_BIT | OpenGL::MAP_COHERENT_BIT;
+
+	if(_openGl->hasDirectStateAccess())
+	{
+		OpenGL::namedBufferStorage(_bufferHandle, _size, nullptr, flags);
+		DE_CHECK_ERROR_OPENGL();
+		_data = static_cast<Uint8*>(OpenGL::mapNamedBufferRange(_bufferHandle, 0, _size, flags));
+	}
+	else
+	{
+		_openGl->bindGraphicsBuffer(_binding, _bufferHandle);
+		OpenGL::bufferStorage(_binding >> 4, _size, nullptr, flags);
+		DE_CHECK_ERROR_OPENGL();
+		_data = static_cast<Uint8*>(OpenGL::mapBufferRange(_binding >> 4, 0, _size, flags));
+	}
+
+	DE_CHECK_ERROR_OPENGL();
+
+	if(_data == nullptr)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to map the buffer data." << Log::Flush();
+		DE_ERROR(0x0);
+	}
+}
+
+void StreamingBuffer::Implementation::waitForFence(const Uint32 frameIndex)
+{
+	OpenGL::Sync& fence = _fences[frameIndex];
+
+	if(fence == nullptr)
+		return;
+
+	Uint32 result;
+
+	do
+	{
+		result = OpenGL::clientWaitSync(fence, OpenGL::SYNC_FLUSH_COMMANDS_BIT, ::FENCE_WAIT_TIMEOUT);
+		DE_CHECK_ERROR_OPENGL();
+	}
+	while(result == OpenGL::TIMEOUT_EXPIRED);
+
+	if(result == OpenGL::WAIT_FAILED)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to wait for the frame fence." << Log::Flush();
+		DE_ERROR(0x0);
+	}
+
+	OpenGL::deleteSync(fence);
+	DE_CHECK_ERROR_OPENGL();
+	fence = nullptr;
+}
+
+
+// Graphics::StreamingBuffer
+
+// Public
+
+StreamingAllocation StreamingBuffer::allocate(const Uint size) const
+{
+	return _implementation->allocate(size);
+}
+
+void StreamingBuffer::endFrame() const
+{
+	_implementation->endFrame();
+}
+
+Uint StreamingBuffer::frameSize() const
+{
+	return _implementation->frameSize();
+}
+
+// Private
+
+StreamingBuffer::StreamingBuffer(GraphicsInterfaceHandle graphicsInterfaceHandle, const BufferBinding& binding,
+	const Uint frameSize)
+	: _implementation(nullptr)
+{
+	_implementation = DE_NEW(Implementation)(graphicsInterfaceHandle, binding, frameSize);
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+	DE_DELETE(_implementation, Implementation);
+}
+
+
+// External
+
+static Uint alignOffset(const Uint offset, const Uint alignment)
+{
+	return (offset + alignment - 1u) / alignment * alignment;
+}
@@ -27,16 +27,12 @@
 #include <platform/opengl/OpenGLIndexBuffer.h>
 #include <platform/opengl/OpenGLGraphicsEnumerations.h>
 #include <platform/opengl/OpenGLVertexBufferState.h>
+#include <platform/opengl/OpenGLVertexLayout.h>
+#include <platform/opengl/OpenGLVertexLayoutCache.h>
 
 using namespace Graphics;
 using namespace Platform;
 
-// External
-
-static Uint32 getVertexElementComponentCount(const VertexElementType& elementType, Bool& normalise);
-static Uint32 getVertexElementSize(const VertexElement& element);
-
-
 // Implementation
 
 // Public
@@ -44,46 +40,82 @@ static Uint32 getVertexElementSize(const VertexElement& element);
 VertexBufferState::Implementation::Implementation(GraphicsInterfaceHandle graphicsInterfaceHandle)
 	: _indexBuffer(nullptr),
 	  _openGl(static_cast<OpenGL*>(graphicsInterfaceHandle)),
+	  _vertexBuffer(nullptr),
+	  _vertexLayout(nullptr),
+	  _vertexBufferOffset(0u),
+	  _vertexBufferStride(0u),
 	  _vertexArrayHandle(0u)
 {
-	OpenGL::genVertexArrays(1, &_vertexArrayHandle);
-	DE_CHECK_ERROR_OPENGL();
+	// With vertex attribute binding, the vertex array is shared through the
+	// vertex layout cache
+
+	if(!_openGl->hasVertexAttribBinding())
+	{
+		OpenGL::genVertexArrays(1, &_vertexArrayHandle);
+		DE_CHECK_ERROR_OPENGL();
+	}
 }
 
 VertexBufferState::Implementation::~Implementation()
 {
-	OpenGL::deleteVertexArrays(1, &_vertexArrayHandle);
-	DE_CHECK_ERROR_OPENGL();
+	if(_vertexArrayHandle != 0u)
+		_openGl->deleteVertexArrayCustom(_vertexArrayHandle);
+}
+
+void VertexBufferState::Implementation::bind() const
+{
+	if(_vertexLayout == nullptr)
+	{
+		_openGl->bindVertexArrayCustom(_vertexArrayHandle);
+		return;
+	}
+
+	const Uint32 indexBufferHandle = _indexBuffer == nullptr ? 0u : _indexBuffer->_implementation->handle();
+
+	_vertexLayout->bind(_vertexBuffer->_implementation->handle(), _vertexBufferOffset, _vertexBufferStride,
+		indexBufferHandle);
 }
 
 void VertexBufferState::Implementation::setIndexBuffer(IndexBuffer* buffer)
 {
-	const Uint32 previousVertexArrayHandle = bind();
+	if(_openGl->hasVertexAttribBinding())
+	{
+		_indexBuffer = buffer;
+		return;
+	}
+
+	const Uint32 previousVertexArrayHandle = bindForEditing();
 
 	if(buffer == nullptr)
 		_indexBuffer->_implementation->debind();
 	else
 		buffer->_implementation->bind();
 
-	debind(previousVertexArrayHandle);
+	debindForEditing(previousVertexArrayHandle);
 	_indexBuffer = buffer;
 }
 
 void VertexBufferState::Implementation::setVertexBuffer(const GraphicsBuffer* buffer,
-	const VertexElementList& vertexElements, const Uint32 stride, const Uint offset) const
+	const VertexElementList& vertexElements, const Uint32 stride, const Uint offset)
 {
 	DE_ASSERT(buffer != nullptr);
 	DE_ASSERT(buffer->_implementation->binding() == BufferBinding::Vertex);
 
-	const Uint32 previousVertexArrayHandle = bind();
+	if(_openGl->hasVertexAttribBinding())
+	{
+		_vertexLayout = _openGl->vertexLayoutCache().get(vertexElements);
+		_vertexBuffer = buffer;
+		_vertexBufferOffset = offset;
+		_vertexBufferStride = stride;
+
+		return;
+	}
+
+	const Uint32 previousVertexArrayHandle = bindForEditing();
 	buffer->_implementation->bind();
 	setVertexLayout(vertexElements, stride, offset);
 
-#if DE_BUILD == DE_BUILD_DEBUG
-	buffer->_implementation->debind();
-#endif
-
-	debind(previousVertexArrayHandle);
+	debindForEditing(previousVertexArrayHandle);
 }
 
 // Private
@@ -101,7 +133,7 @@ void VertexBufferState::Implementation::setVertexLayout(const VertexElementList&
 			elementOffset += i->offset;
 
 		setVertexElementFormat(*i, elementOffset, stride);
-		elementOffset += ::getVertexElementSize(*i);
+		elementOffset += VertexLayout::getElementSize(*i);
 	}
 }
 
@@ -117,7 +149,7 @@ void VertexBufferState::Implementation::setVertexElementFormat(const VertexEleme
 	const Uint elementOffset, const Uint32 stride)
 {
 	Bool normalise = false;
-	const Uint32 componentCount = ::getVertexElementComponentCount(element.type, normalise);
+	const Uint32 componentCount = VertexLayout::getComponentCount(element.type, normalise);
 	const Uint32 elementType = static_cast<Uint32>(element.type) >> 4;
 	OpenGL::enableVertexAttribArray(element.index);
 	DE_CHECK_ERROR_OPENGL();
@@ -126,6 +158,8 @@ void VertexBufferState::Implementation::setVertexElementFormat(const VertexEleme
 		reinterpret_cast<Void*>(elementOffset));
 
 	DE_CHECK_ERROR_OPENGL();
+	OpenGL::vertexAttribDivisor(element.index, element.divisor);
+	DE_CHECK_ERROR_OPENGL();
 }
 
 
@@ -157,104 +191,3 @@ VertexBufferState::~VertexBufferState()
 	DE_DELETE(_implementation, Implementation);
 }
 
-
-// External
-
-static Uint32 getVertexElementComponentCount(const VertexElementType& elementType, Bool& normalise)
-{
-	const Int32 elementTypeId = static_cast<Int32>(elementType);
-	normalise = (elementTypeId & 0x04) == 0x04;
-
-	if((elementTypeId & 0x08) == 0x08)
-		return OpenGL::BGRA;
-
-	return (elementTypeId & 0x03) + 1u;
-}
-
-static Uint32 getVertexElementSize(const VertexElement& element)
-{
-	switch(element.type)
-	{
-		case VertexElementType::A2B10G10R10Int:
-		case VertexElementType::A2B10G10R10IntNormalised:
-		case VertexElementType::A2B10G10R10Uint:
-		case VertexElementType::A2B10G10R10UintNormalised:
-		case VertexElementType::A2R10G10B10IntNormalised:
-		case VertexElementType::A2R10G10B10UintNormalised:
-		case VertexElementType::B8G8R8A8UintNormalised:
-		case VertexElementType::R16G16Float:
-		case VertexElementType::R32Float:
-		case VertexElementType::R8G8B8A8Int:
-		case VertexElementType::R8G8B8A8IntNormalised:
-		case VertexElementType::R16G16Int:
-		case VertexElementType::R16G16IntNormalised:
-		case VertexElementType::R32Int:
-		case VertexElementType::R32IntNormalised:
-		case VertexElementType::R8G8B8A8Uint:
-		case VertexElementType::R8G8B8A8UintNormalised:
-		case VertexElementType::R16G16Uint:
-		case VertexElementType::R16G16UintNormalised:
-		case VertexElementType::R32Uint:
-		case VertexElementType::R32UintNormalised:
-			return 4u;
-
-		case VertexElementType::R16Float:
-		case VertexElementType::R8G8Int:
-		case VertexElementType::R8G8IntNormalised:
-		case VertexElementType::R16Int:
-		case VertexElementType::R16IntNormalised:
-		case VertexElementType::R8G8Uint:
-		case VertexElementType::R8G8UintNormalised:
-		case VertexElementType::R16Uint:
-		case VertexElementType::R16UintNormalised:
-			return 2u;
-
-		case VertexElementType::R16G16B16Float:
-		case VertexElementType::R16G16B16Int:
-		case VertexElementType::R16G16B16IntNormalised:
-		case VertexElementType::R16G16B16Uint:
-		case VertexElementType::R16G16B16UintNormalised:
-			return 6u;
-
-		case VertexElementType::R16G16B16A16Float:
-		case VertexElementType::R32G32Float:
-		case VertexElementType::R16G16B16A16Int:
-		case VertexElementType::R16G16B16A16IntNormalised:
-		case VertexElementType::R32G32Int:
-		case VertexElementType::R32G32IntNormalised:
-		case VertexElementType::R16G16B16A16Uint:
-		case VertexElementType::R16G16B16A16UintNormalised:
-		case VertexElementType::R32G32Uint:
-		case VertexElementType::R32G32UintNormalised:
-			return 8u;
-
-		case VertexElementType::R32G32B32Float:
-		case VertexElementType::R32G32B32Int:
-		case VertexElementType::R32G32B32IntNormalised:
-		case VertexElementType::R32G32B32Uint:
-		case VertexElementType::R32G32B32UintNormalised:
-			return 12u;
-
-		case VertexElementType::R32G32B32A32Float:
-		case VertexElementType::R32G32B32A32Int:
-		case VertexElementType::R32G32B32A32IntNormalised:
-		case VertexElementType::R32G32B32A32Uint:
-		case VertexElementType::R32G32B32A32UintNormalised:
-			return 16u;
-
-		case VertexElementType::R8Int:
-		case VertexElementType::R8IntNormalised:
-		case VertexElementType::R8Uint:
-		case VertexElementType::R8UintNormalised:
-			return 1u;
-
-		case VertexElementType::R8G8B8Int:
-		case VertexElementType::R8G8B8IntNormalised:
-		case VertexElementType::R8G8B8Uint:
-		case VertexElementType::R8G8B8UintNormalised:
-			return 3u;
-
-		default:
-			return 0u;
-	}
-}
@@ -0,0 +1,285 @@
+/**
+ * @file platform/opengl/OpenGLVertexLayout.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Memory.h>
+#include <graphics/VertexElement.h>
+#include <platform/opengl/OpenGL.h>
+#include <platform/opengl/OpenGLGraphicsEnumerations.h>
+#include <platform/opengl/OpenGLVertexLayout.h>
+
+using namespace Graphics;
+using namespace Platform;
+
+// Public
+
+VertexLayout::VertexLayout(OpenGL* openGl, const VertexElementList& vertexElements)
+	: _openGl(openGl),
+	  _vertexBufferOffset(0u),
+	  _vertexBufferHandle(0u),
+	  _vertexBufferStride(0u),
+	  _indexBufferHandle(0u),
+	  _packedStride(0u),
+	  _vertexArrayHandle(0u)
+{
+	createVertexArray(vertexElements);
+}
+
+VertexLayout::~VertexLayout()
+{
+	_openGl->deleteVertexArrayCustom(_vertexArrayHandle);
+}
+
+void VertexLayout::bind(const Uint32 vertexBufferHandle, const Uint vertexBufferOffset,
+	const Uint32 vertexBufferStride, const Uint32 indexBufferHandle)
+{
+	_openGl->bindVertexArrayCustom(_vertexArrayHandle);
+
+	if(vertexBufferHandle == _vertexBufferHandle && vertexBufferOffset == _vertexBufferOffset &&
+		vertexBufferStride == _vertexBufferStride)
+	{
+		_openGl->countFilteredCall();
+	}
+	else
+	{
+		// A binding stride of 0 would read the same vertex for every index
+
+		const Uint32 stride = vertexBufferStride == 0u ? _packedStride : vertexBufferStride;
+
+		for(Uint32 i = 0u, count = _bindingDivisors.size(); i < count; ++i)
+		{
+			OpenGL::bindVertexBuffer(i, vertexBufferHandle, vertexBufferOffset, stride);
+			DE_CHECK_ERROR_OPENGL();
+			_openGl->countIssuedCall();
+		}
+
+		_vertexBufferHandle = vertexBufferHandle;
+		_vertexBufferOffset = vertexBufferOffset;
+		_vertexBufferStride = vertexBufferStride;
+	}
+
+	if(indexBufferHandle == _indexBufferHandle)
+	{
+		_openGl->countFilteredCall();
+	}
+	else
+	{
+		OpenGL::bindBuffer(OpenGL::ELEMENT_ARRAY_BUFFER, indexBufferHandle);
+		DE_CHECK_ERROR_OPENGL();
+		_openGl->countIssuedCall();
+		_indexBufferHandle = indexBufferHandle;
+	}
+}
+
+void VertexLayout::forgetBuffer(const Uint32 bufferHandle)
+{
+	if(bufferHandle == _vertexBufferHandle)
+		_vertexBufferHandle = 0u;
+
+	if(bufferHandle == _indexBufferHandle)
+		_indexBufferHandle = 0u;
+}
+
+// Private
+
+void VertexLayout::createVertexArray(const VertexElementList& vertexElements)
+{
+	Uint32 previousVertexArrayHandle = 0u;
+
+	if(_openGl->hasDirectStateAccess())
+	{
+		OpenGL::createVertexArrays(1, &_vertexArrayHandle);
+		DE_CHECK_ERROR_OPENGL();
+	}
+	else
+	{
+		OpenGL::genVertexArrays(1, &_vertexArrayHandle);
+		DE_CHECK_ERROR_OPENGL();
+		previousVertexArrayHandle = _openGl->bindVertexArrayCustom(_vertexArrayHandle);
+	}
+
+	Uint32 elementOffset = 0u;
+
+	for(VertexElementList::const_iterator i = vertexElements.begin(), end = vertexElements.end();
+		i != end; ++i)
+	{
+		if(i->offset != VertexElement::AFTER_PREVIOUS)
+			elementOffset += i->offset;
+
+		setAttributeFormat(*i, elementOffset, getBindingIndex(i->divisor));
+		elementOffset += getElementSize(*i);
+	}
+
+	_packedStride = elementOffset;
+
+	if(!_openGl->hasDirectStateAccess())
+		_openGl->bindVertexArrayCustom(previousVertexArrayHandle);
+}
+
+Uint32 VertexLayout::getBindingIndex(const Uint32 divisor)
+{
+	for(Uint32 i = 0u, count = _bindingDivisors.size(); i < count; ++i)
+	{
+		if(_bindingDivisors[i] == divisor)
+			return i;
+	}
+
+	const Uint32 bindingIndex = _bindingDivisors.size();
+	_bindingDivisors.push_back(divisor);
+
+	if(_openGl->hasDirectStateAccess())
+		OpenGL::vertexArrayBindingDivisor(_vertexArrayHandle, bindingIndex, divisor);
+	else
+		OpenGL::vertexBindingDivisor(bindingIndex, divisor);
+
+	DE_CHECK_ERROR_OPENGL();
+
+	return bindingIndex;
+}
+
+void VertexLayout::setAttributeFormat(const VertexElement& element, const Uint32 relativeOffset,
+	const Uint32 bindingIndex) const
+{
+	Bool normalise = false;
+	const Uint32 componentCount = getComponentCount(element.type, normalise);
+	const Uint32 elementType = static_cast<Uint32>(element.type) >> 4;
+
+	if(_openGl->hasDirectStateAccess())
+	{
+		OpenGL::enableVertexArrayAttrib(_vertexArrayHandle, element.index);
+		DE_CHECK_ERROR_OPENGL();
+
+		OpenGL::vertexArrayAttribFormat(_vertexArrayHandle, element.index, componentCount, elementType,
+			normalise, relativeOffset);
+
+		DE_CHECK_ERROR_OPENGL();
+		OpenGL::vertexArrayAttribBinding(_vertexArrayHandle, element.index, bindingIndex);
+	}
+	else
+	{
+		OpenGL::enableVertexAttribArray(element.index);
+		DE_CHECK_ERROR_OPENGL();
+		OpenGL::vertexAttribFormat(element.index, componentCount, elementType, normalise, relativeOffset);
+		DE_CHECK_ERROR_OPENGL();
+		OpenGL::vertexAttribBinding(element.index, bindingIndex);
+	}
+
+	DE_CHECK_ERROR_OPENGL();
+}
+
+// Static
+
+Uint32 VertexLayout::getComponentCount(const VertexElementType& elementType, Bool& normalise)
+{
+	const Int32 elementTypeId = static_cast<Int32>(elementType);
+	normalise = (elementTypeId & 0x04) == 0x04;
+
+	if((elementTypeId & 0x08) == 0x08)
+		return OpenGL::BGRA;
+
+	return (elementTypeId & 0x03) + 1u;
+}
+
+Uint32 VertexLayout::getElementSize(const VertexElement& element)
+{
+	switch(element.type)
+	{
+		case VertexElementType::A2B10G10R10Int:
+		case VertexElementType::A2B10G10R10IntNormalised:
+		case VertexElementType::A2B10G10R10Uint:
+		case VertexElementType::A2B10G10R10UintNormalised:
+		case VertexElementType::A2R10G10B10IntNormalised:
+		case VertexElementType::A2R10G10B10UintNormalised:
+		case VertexElementType::B8G8R8A8UintNormalised:
+		case VertexElementType::R16G16Float:
+		case VertexElementType::R32Float:
+		case VertexElementType::R8G8B8A8Int:
+		case VertexElementType::R8G8B8A8IntNormalised:
+		case VertexElementType::R16G16Int:
+		case VertexElementType::R16G16IntNormalised:
+		case VertexElementType::R32Int:
+		case VertexElementType::R32IntNormalised:
+		case VertexElementType::R8G8B8A8Uint:
+		case VertexElementType::R8G8B8A8UintNormalised:
+		case VertexElementType::R16G16Uint:
+		case VertexElementType::R16G16UintNormalised:
+		case VertexElementType::R32Uint:
+		case VertexElementType::R32UintNormalised:
+			return 4u;
+
+		case VertexElementType::R16Float:
+		case VertexElementType::R8G8Int:
+		case VertexElementType::R8G8IntNormalised:
+		case VertexElementType::R16Int:
+		case VertexElementType::R16IntNormalised:
+		case VertexElementType::R8G8Uint:
+		case VertexElementType::R8G8UintNormalised:
+		case VertexElementType::R16Uint:
+		case VertexElementType::R16UintNormalised:
+			return 2u;
+
+		case VertexElementType::R16G16B16Float:
+		case VertexElementType::R16G16B16Int:
+		case VertexElementType::R16G16B16IntNormalised:
+		case VertexElementType::R16G16B16Uint:
+		case VertexElementType::R16G16B16UintNormalised:
+			return 6u;
+
+		case VertexElementType::R16G16B16A16Float:
+		case VertexElementType::R32G32Float:
+		case VertexElementType::R16G16B16A16Int:
+		case VertexElementType::R16G16B16A16IntNormalised:
+		case VertexElementType::R32G32Int:
+		case VertexElementType::R32G32IntNormalised:
+		case VertexElementType::R16G16B16A16Uint:
+		case VertexElementType::R16G16B16A16UintNormalised:
+		case VertexElementType::R32G32Uint:
+		case VertexElementType::R32G32UintNormalised:
+			return 8u;
+
+		case VertexElementType::R32G32B32Float:
+		case VertexElementType::R32G32B32Int:
+		case VertexElementType::R32G32B32IntNormalised:
+		case VertexElementType::R32G32B32Uint:
+		case VertexElementType::R32G32B32UintNormalised:
+			return 12u;
+
+		case VertexElementType::R32G32B32A32Float:
+		case VertexElementType::R32G32B32A32Int:
+		case VertexElementType::R32G32B32A32IntNormalised:
+		case VertexElementType::R32G32B32A32Uint:
+		case VertexElementType::R32G32B32A32UintNormalised:
+			return 16u;
+
+		case VertexElementType::R8Int:
+		case VertexElementType::R8IntNormalised:
+		case VertexElementType::R8Uint:
+		case VertexElementType::R8UintNormalised:
+			return 1u;
+
+		case VertexElementType::R8G8B8Int:
+		case VertexElementType::R8G8B8IntNormalised:
+		case VertexElementType::R8G8B8Uint:
+		case VertexElementType::R8G8B8UintNormalised:
+			return 3u;
+
+		default:
+			return 0u;
+	}
+}
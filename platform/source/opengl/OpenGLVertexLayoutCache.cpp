@@ -0,0 +1,95 @@
+/**
+ * @file platform/opengl/OpenGLVertexLayoutCache.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Hash.h>
+#include <core/Memory.h>
+#include <graphics/VertexElement.h>
+#include <platform/opengl/OpenGLVertexLayout.h>
+#include <platform/opengl/OpenGLVertexLayoutCache.h>
+
+using namespace Core;
+using namespace Graphics;
+using namespace Platform;
+
+// Public
+
+VertexLayoutCache::VertexLayoutCache(OpenGL* openGl)
+	: _openGl(openGl) { }
+
+VertexLayoutCache::~VertexLayoutCache()
+{
+	for(LayoutMap::const_iterator i = _layouts.begin(), end = _layouts.end(); i != end; ++i)
+		DE_DELETE(i->second, VertexLayout);
+}
+
+void VertexLayoutCache::forgetBuffer(const Uint32 bufferHandle) const
+{
+	for(LayoutMap::const_iterator i = _layouts.begin(), end = _layouts.end(); i != end; ++i)
+		i->second->forgetBuffer(bufferHandle);
+}
+
+VertexLayout* VertexLayoutCache::get(const VertexElementList& vertexElements)
+{
+	const LayoutMap::const_iterator iterator = _layouts.find(vertexElements);
+
+	if(iterator != _layouts.end())
+		return iterator->second;
+
+	VertexLayout* vertexLayout = DE_NEW(VertexLayout)(_openGl, vertexElements);
+	_layouts.emplace(vertexElements, vertexLayout);
+
+	return vertexLayout;
+}
+
+
+// VertexElementListHash
+
+// Public
+
+Uint VertexLayoutCache::VertexElementListHash::operator ()(const VertexElementList& vertexElements) const
+{
+	return static_cast<Uint>(hashBytes(vertexElements.data(), vertexElements.size() * sizeof(VertexElement)));
+}
+
+
+// VertexElementListEqual
+
+// Public
+
+Bool VertexLayoutCache::VertexElementListEqual::operator ()(const VertexElementList& vertexElementsA,
+	const VertexElementList& vertexElementsB) const
+{
+	if(vertexElementsA.size() != vertexElementsB.size())
+		return false;
+
+	for(Uint i = 0u; i < vertexElementsA.size(); ++i)
+	{
+		const VertexElement& elementA = vertexElementsA[i];
+		const VertexElement& elementB = vertexElementsB[i];
+
+		if(elementA.divisor != elementB.divisor || elementA.index != elementB.index ||
+			elementA.offset != elementB.offset || elementA.type != elementB.type)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -70,3 +70,13 @@ String8 FileSystem::getDefaultContentRootDirectory()
 	const String8 path(pathBuffer.data(), bytesStored);
 	return path.substr(0u, path.rfind('/') + 1u);
 }
+
+Bool FileSystem::isReadable(const String8& filepath)
+{
+	return access(filepath.c_str(), R_OK) == 0;
+}
+
+Bool FileSystem::isWritable(const String8& path)
+{
+	return access(path.c_str(), W_OK) == 0;
+}
@@ -18,6 +18,9 @@
  * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <limits.h>
+#include <sched.h>
+#include <unistd.h>
 #include <core/Log.h>
 #include <core/Memory.h>
 #include <platform/posix/POSIX.h>
@@ -30,7 +33,7 @@ using namespace Platform;
 
 static const Char8* COMPONENT_TAG = "[Core::Thread - POSIX] ";
 
-static pthread_attr_t createThreadAttributes(const Bool isJoinable);
+static pthread_attr_t createThreadAttributes(const Bool isJoinable, const Uint32 stackSize);
 static void destroyThreadAttributes(pthread_attr_t& attributes);
 
 
@@ -71,13 +74,28 @@ Int32 Thread::Implementation::join() const
 	return static_cast<Int32>(reinterpret_cast<Int>(exitValue));
 }
 
-void Thread::Implementation::run(ThreadEntryFunction entryFunction, Void* parameter, const Bool isJoinable)
+void Thread::Implementation::run(ThreadEntryFunction entryFunction, Void* parameter,
+	const ThreadOptions& options, const Bool isJoinable)
 {
-	pthread_attr_t attributes = ::createThreadAttributes(isJoinable);
+	pthread_attr_t attributes = ::createThreadAttributes(isJoinable, options.stackSize);
 	ThreadParameter* entryParameter = DE_NEW(ThreadParameter);
 	entryParameter->entryFunction = entryFunction;
 	entryParameter->userParameter = parameter;
 	entryParameter->thread = this;
+	entryParameter->affinityMask = options.affinityMask;
+	entryParameter->priority = options.priority;
+	Uint32 nameLength = 0u;
+
+	if(options.name != nullptr)
+	{
+		while(nameLength < ThreadOptions::MAX_NAME_LENGTH && options.name[nameLength] != '\0')
+		{
+			entryParameter->name[nameLength] = options.name[nameLength];
+			++nameLength;
+		}
+	}
+
+	entryParameter->name[nameLength] = '\0';
 
 	const Int32 result = pthread_create(&_threadHandle, &attributes, Implementation::entryFunction,
 		entryParameter);
@@ -102,12 +120,15 @@ void Thread::Implementation::run(ThreadEntryFunction entryFunction, Void* parame
 
 // Static
 
+// Thread::Implementation::applyOptions() is implemented in platform/source/linux/LinuxThread.cpp
+
 Void* Thread::Implementation::entryFunction(Void* parameter)
 {
 	ThreadParameter* entryParameterPointer = static_cast<ThreadParameter*>(parameter);
 	ThreadParameter entryParameter = *entryParameterPointer;
 	DE_DELETE(entryParameterPointer, ThreadParameter);
 	entryParameter.thread->_id = currentID();
+	applyOptions(entryParameter);
 	const Int32 exitValue = entryParameter.entryFunction(entryParameter.userParameter);
 
 	return reinterpret_cast<Void*>(exitValue);
@@ -151,7 +172,13 @@ Int32 Thread::join() const
 
 void Thread::run(ThreadEntryFunction entryFunction, Void* parameter, const Bool isJoinable) const
 {
-	_implementation->run(entryFunction, parameter, isJoinable);
+	_implementation->run(entryFunction, parameter, ThreadOptions(), isJoinable);
+}
+
+void Thread::run(ThreadEntryFunction entryFunction, Void* parameter, const ThreadOptions& options,
+	const Bool isJoinable) const
+{
+	_implementation->run(entryFunction, parameter, options, isJoinable);
 }
 
 // Static
@@ -161,10 +188,30 @@ Uint32 Thread::currentID()
 	return Implementation::currentID();
 }
 
+Uint32 Thread::hardwareConcurrency()
+{
+	const long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if(processorCount < 1)
+	{
+		defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "Failed to get the number of processors." <<
+			Log::Flush();
+
+		return 1u;
+	}
+
+	return static_cast<Uint32>(processorCount);
+}
+
+void Thread::yield()
+{
+	sched_yield();
+}
+
 
 // External
 
-static pthread_attr_t createThreadAttributes(const Bool isJoinable)
+static pthread_attr_t createThreadAttributes(const Bool isJoinable, const Uint32 stackSize)
 {
 	pthread_attr_t attributes;
 	Int32 result = pthread_attr_init(&attributes);
@@ -188,6 +235,20 @@ static pthread_attr_t createThreadAttributes(const Bool isJoinable)
 		DE_ERROR_POSIX_CODE(0x0, result);
 	}
 
+	if(stackSize > 0u)
+	{
+		const Uint stackSizeValue = stackSize < PTHREAD_STACK_MIN ? PTHREAD_STACK_MIN : stackSize;
+		result = pthread_attr_setstacksize(&attributes, stackSizeValue);
+
+		if(result != POSIX_RESULT_OK)
+		{
+			defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to set the thread stack size." <<
+				Log::Flush();
+
+			DE_ERROR_POSIX_CODE(0x0, result);
+		}
+	}
+
 	return attributes;
 }
 
@@ -18,22 +18,19 @@
  * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <codecvt>
 #include <cstdlib>
-#include <locale>
+#include <core/Error.h>
 #include <core/Log.h>
 #include <core/Rectangle.h>
+#include <core/Unicode.h>
 #include <core/debug/Assert.h>
 #include <platform/windows/Windows.h>
 
 using namespace Core;
-using namespace Memory;
 
 // External
 
-using StringConverter =
-	std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t, STDAllocator<wchar_t>,
-		STDAllocator<Char8>>;
+static_assert(sizeof(wchar_t) == sizeof(Char16), "The size of wchar_t is not the size of Char16.");
 
 
 // Platform
@@ -90,12 +87,37 @@ void Platform::invokeWindowsError(const Uint32 errorCode)
 
 String8 Platform::fromWideString(const WideString& string)
 {
-	StringConverter converter;
-	return converter.to_bytes(string);
+	const Char16* wideString = reinterpret_cast<const Char16*>(string.data());
+	const Uint length = Unicode::toUtf8Length(wideString, string.length());
+
+	if(length == Unicode::INVALID_LENGTH)
+	{
+		defaultLog << LogLevel::Error << "[Platform::fromWideString() - Windows]"
+			" Failed to convert an invalid UTF-16 string." << Log::Flush();
+
+		DE_ERROR(0x0);
+	}
+
+	String8 convertedString(length, '\0');
+	Unicode::toUtf8(wideString, string.length(), &convertedString[0], length);
+
+	return convertedString;
 }
 
 Platform::WideString Platform::toWideString(const Core::String8& string)
 {
-	StringConverter converter;
-	return converter.from_bytes(string);
+	const Uint length = Unicode::toUtf16Length(string.data(), string.length());
+
+	if(length == Unicode::INVALID_LENGTH)
+	{
+		defaultLog << LogLevel::Error << "[Platform::toWideString() - Windows]"
+			" Failed to convert an invalid UTF-8 string." << Log::Flush();
+
+		DE_ERROR(0x0);
+	}
+
+	WideString convertedString(length, L'\0');
+	Unicode::toUtf16(string.data(), string.length(), reinterpret_cast<Char16*>(&convertedString[0]), length);
+
+	return convertedString;
 }
@@ -56,3 +56,21 @@ String8 FileSystem::getDefaultContentRootDirectory()
 {
 	return String8();
 }
+
+Bool FileSystem::isReadable(const String8& filepath)
+{
+	return fileExists(filepath);
+}
+
+Bool FileSystem::isWritable(const String8& path)
+{
+	// The read-only attribute is not honoured for directories, so a directory
+	// is assumed to be writable if it exists
+
+	const Uint32 fileAttributes = GetFileAttributesW(toWideString(path).c_str());
+
+	if(fileAttributes == INVALID_FILE_ATTRIBUTES)
+		return false;
+
+	return (fileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0u || (fileAttributes & FILE_ATTRIBUTE_READONLY) == 0u;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file platform/windows/WindowsFutex.cpp
+ *
+ * DevEngine
+ * Copyright 2015-2016 Eetu 'Devenec' Oinasmaa
+ *
+ * DevEngine is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DevEngine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Futex.h>
+#include <core/Log.h>
+#include <platform/windows/Windows.h>
+
+using namespace Core;
+
+// External
+
+static const Char8* COMPONENT_TAG = "[Core::Futex - Windows] ";
+
+
+// Public
+
+// Static
+
+void Futex::wait(std::atomic<Uint32>& value, const Uint32 expectedValue)
+{
+	Uint32 compareValue = expectedValue;
+	const Int32 result = WaitOnAddress(&value, &compareValue, sizeof(Uint32), INFINITE);
+
+	if(result == 0)
+	{
+		defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to wait on the address." << Log::Flush();
+		DE_ERROR_WINDOWS(0x0);
+	}
+}
+
+void Futex::wakeAll(std::atomic<Uint32>& value)
+{
+	WakeByAddressAll(&value);
+}
+
+void Futex::wakeOne(std::atomic<Uint32>& value)
+{
+	WakeByAddressSingle(&value);
+}
@@ -18,6 +18,7 @@
  * along with DevEngine. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <core/Array.h>
 #include <core/Log.h>
 #include <core/Memory.h>
 #include <core/Thread.h>
@@ -34,8 +35,12 @@ struct ThreadParameter
 	Void* userParameter;
 };
 
+using SetThreadDescriptionFunction = HRESULT (DE_INTERNAL_CALL_STDCALL*)(HANDLE thread, const wchar_t* description);
+
 static const Char8* COMPONENT_TAG = "[Core::Thread - Windows] ";
 
+static Int32 getPriorityValue(const ThreadPriority& priority);
+
 static unsigned long DE_INTERNAL_CALL_STDCALL threadEntryFunction(Void* parameter);
 
 
@@ -88,12 +93,19 @@ public:
 		return exitValue;
 	}
 
-	void run(ThreadEntryFunction entryFunction, Void* parameter, const Bool isJoinable)
+	void run(ThreadEntryFunction entryFunction, Void* parameter, const ThreadOptions& options,
+		const Bool isJoinable)
 	{
 		ThreadParameter* threadParameter = DE_NEW(ThreadParameter);
 		threadParameter->entryFunction = entryFunction;
 		threadParameter->userParameter = parameter;
-		_threadHandle = CreateThread(nullptr, 0u, threadEntryFunction, threadParameter, 0u, nullptr);
+		Uint32 creationFlags = CREATE_SUSPENDED;
+
+		if(options.stackSize > 0u)
+			creationFlags |= STACK_SIZE_PARAM_IS_A_RESERVATION;
+
+		_threadHandle = CreateThread(nullptr, options.stackSize, threadEntryFunction, threadParameter,
+			creationFlags, nullptr);
 
 		if(_threadHandle == nullptr)
 		{
@@ -103,6 +115,16 @@ public:
 			DE_ERROR_WINDOWS(0x0);
 		}
 
+		applyOptions(options);
+
+		if(ResumeThread(_threadHandle) == static_cast<unsigned long>(-1))
+		{
+			defaultLog << LogLevel::Error << ::COMPONENT_TAG << "Failed to resume the thread." <<
+				Log::Flush();
+
+			DE_ERROR_WINDOWS(0x0);
+		}
+
 		if(!isJoinable)
 			closeThreadHandle();
 
@@ -122,6 +144,56 @@ private:
 	HANDLE _threadHandle;
 	Bool _isJoinable;
 
+	void applyOptions(const ThreadOptions& options) const
+	{
+		if(options.affinityMask != 0u &&
+			SetThreadAffinityMask(_threadHandle, static_cast<DWORD_PTR>(options.affinityMask)) == 0u)
+		{
+			defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "Failed to set the thread affinity." <<
+				Log::Flush();
+		}
+
+		if(options.priority != ThreadPriority::Normal &&
+			SetThreadPriority(_threadHandle, ::getPriorityValue(options.priority)) == 0)
+		{
+			defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "Failed to set the thread priority." <<
+				Log::Flush();
+		}
+
+		if(options.name != nullptr)
+			setName(options.name);
+	}
+
+	void setName(const Char8* name) const
+	{
+		// SetThreadDescription() is available since Windows 10 version 1607
+
+		const HMODULE kernelModule = GetModuleHandleW(L"kernel32.dll");
+
+		const SetThreadDescriptionFunction setThreadDescription =
+			reinterpret_cast<SetThreadDescriptionFunction>(GetProcAddress(kernelModule, "SetThreadDescription"));
+
+		if(setThreadDescription == nullptr)
+			return;
+
+		Array<wchar_t, ThreadOptions::MAX_NAME_LENGTH + 1u> wideName;
+		Uint32 nameLength = 0u;
+
+		while(nameLength < ThreadOptions::MAX_NAME_LENGTH && name[nameLength] != '\0')
+		{
+			wideName[nameLength] = static_cast<wchar_t>(name[nameLength]);
+			++nameLength;
+		}
+
+		wideName[nameLength] = L'\0';
+
+		if(FAILED(setThreadDescription(_threadHandle, wideName.data())))
+		{
+			defaultLog << LogLevel::Warning << ::COMPONENT_TAG << "Failed to set the thread name." <<
+				Log::Flush();
+		}
+	}
+
 	void closeThreadHandle()
 	{
 		const Int32 result = CloseHandle(_threadHandle);
@@ -203,7 +275,13 @@ Int32 Thread::join() const
 
 void Thread::run(ThreadEntryFunction entryFunction, Void* parameter, const Bool isJoinable) const
 {
-	_implementation->run(entryFunction, parameter, isJoinable);
+	_implementation->run(entryFunction, parameter, ThreadOptions(), isJoinable);
+}
+
+void Thread::run(ThreadEntryFunction entryFunction, Void* parameter, const ThreadOptions& options,
+	const Bool isJoinable) const
+{
+	_implementation->run(entryFunction, parameter, options, isJoinable);
 }
 
 // Static
@@ -213,6 +291,19 @@ Uint32 Thread::currentID()
 	return Implementation::currentID();
 }
 
+Uint32 Thread::hardwareConcurrency()
+{
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+
+	return systemInfo.dwNumberOfProcessors;
+}
+
+void Thread::yield()
+{
+	SwitchToThread();
+}
+
 
 // External
 
@@ -224,3 +315,24 @@ static unsigned long DE_INTERNAL_CALL_STDCALL threadEntryFunction(Void* paramete
 
 	return threadParameterCopy.entryFunction(threadParameterCopy.userParameter);
 }
+
+static Int32 getPriorityValue(const ThreadPriority& priority)
+{
+	switch(priority)
+	{
+		case ThreadPriority::Lowest:
+			return THREAD_PRIORITY_LOWEST;
+
+		case ThreadPriority::Low:
+			return THREAD_PRIORITY_BELOW_NORMAL;
+
+		case ThreadPriority::High:
+			return THREAD_PRIORITY_ABOVE_NORMAL;
+
+		case ThreadPriority::Highest:
+			return THREAD_PRIORITY_HIGHEST;
+
+		default:
+			return THREAD_PRIORITY_NORMAL;
+	}
+}
@@ -79,7 +79,7 @@ void Graphics::Window::Implementation::setIcon(const Image* image)
 
 void Graphics::Window::Implementation::setTitle(const String8& title) const
 {
-	X::instance().setWindowTitle(_windowHandle, title.c_str());
+	X::instance().setWindowTitle(_windowHandle, title);
 }
 
 
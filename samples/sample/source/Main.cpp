@@ -20,7 +20,9 @@
 
 #include <algorithm>
 #include <content/ContentManager.h>
+#include <core/Event.h>
 #include <core/Main.h>
+#include <core/Name.h>
 #include <core/Singleton.h>
 #include <core/Thread.h>
 #include <core/Types.h>
@@ -40,6 +42,7 @@
 #include <graphics/GraphicsEnumerations.h>
 #include <graphics/Image.h>
 #include <graphics/IndexBuffer.h>
+#include <graphics/StreamingBuffer.h>
 #include <graphics/VertexBufferState.h>
 #include <graphics/VertexElement.h>
 #include <graphics/Window.h>
@@ -62,7 +65,7 @@ public:
 		  _vertexBuffer(nullptr),
 		  _vertexBufferState(nullptr),
 		  _window(nullptr),
-		  _isRunning(true) { }
+		  _exitEvent(EventResetMode::Manual) { }
 
 	App(const App& app) = delete;
 	App(App&& app) = delete;
@@ -73,7 +76,7 @@ public:
 	{
 		_graphicsDeviceManager.createWindow(960u, 640u);
 
-		while(_isRunning)
+		while(!_exitEvent.isSet())
 			_graphicsDeviceManager.processWindowMessages();
 
 		_updateThread.join();
@@ -90,12 +93,13 @@ private:
 	Effect* _effect;
 	GraphicsDevice* _graphicsDevice;
 	IndexBuffer* _indexBuffer;
-	GraphicsBuffer* _uniformBuffer;
+	Matrix4 _projectionTransform;
+	StreamingBuffer* _uniformBuffer;
 	Thread _updateThread;
 	GraphicsBuffer* _vertexBuffer;
 	VertexBufferState* _vertexBufferState;
 	Window* _window;
-	Bool _isRunning;
+	Event _exitEvent;
 
 	void initialise()
 	{
@@ -107,7 +111,7 @@ private:
 		_graphicsDevice = _graphicsDeviceManager.createDevice(_window);
 		EffectCode* effectCode = _contentManager.load<EffectCode>("assets/effect.glsl");
 		_effect = _graphicsDevice->createEffect(effectCode);
-		_effect->setUniformBlockBinding(0u, 0u);
+		_effect->setUniformBlockBinding(Name("Transforms"), 0u);
 		initialiseVertexBuffer();
 		initialiseIndexBuffer();
 		initialiseVertexBufferState();
@@ -132,13 +136,18 @@ private:
 			worldTransform =
 				Matrix4::createTranslation(0.0f, 0.0f, -15.0f) * Matrix4::createRotation(axis, rotation);
 
-			Uint8* mappedData = _uniformBuffer->mapData(sizeof(Matrix4), sizeof(Matrix4));
+			const StreamingAllocation allocation = _uniformBuffer->allocate(2u * sizeof(Matrix4));
+			const Uint8* projectionTransformData = reinterpret_cast<const Uint8*>(_projectionTransform.data());
 			const Uint8* worldTransformData = reinterpret_cast<const Uint8*>(worldTransform.data());
-			std::copy(worldTransformData, worldTransformData + sizeof(Matrix4), mappedData);
-			_uniformBuffer->demapData();
+			std::copy(projectionTransformData, projectionTransformData + sizeof(Matrix4), allocation.data);
 
+			std::copy(worldTransformData, worldTransformData + sizeof(Matrix4),
+				allocation.data + sizeof(Matrix4));
+
+			_graphicsDevice->bindBufferRange(_uniformBuffer, 0u, allocation);
 			_graphicsDevice->draw(PrimitiveType::TriangleStrip, 4u);
 			_graphicsDevice->swapBuffers();
+			_uniformBuffer->endFrame();
 		}
 	}
 
@@ -233,7 +242,7 @@ private:
 		const Float32 top = near * tangent(0.5f * 1.047f);
 		const Float32 right = 800.0f / 600.0f * top;
 
-		const Matrix4 projectionTransform
+		_projectionTransform = Matrix4
 		(
 			near / right, 0.0f,		   0.0f,							  0.0f,
 			0.0f,		  near / top,  0.0f,							  0.0f,
@@ -241,15 +250,7 @@ private:
 			0.0f,		  0.0f,		  -2.0f * near * far / (far - near),  0.0f
 		);
 
-		_uniformBuffer =
-			_graphicsDevice->createBuffer(BufferBinding::Uniform, 32u * sizeof(Float32), AccessMode::Write,
-				BufferUsage::Stream);
-
-		Uint8* mappedData = _uniformBuffer->mapData(sizeof(Matrix4));
-		const Uint8* projectionTransformData = reinterpret_cast<const Uint8*>(projectionTransform.data());
-		std::copy(projectionTransformData, projectionTransformData + sizeof(Matrix4), mappedData);
-		_uniformBuffer->demapData();
-		_graphicsDevice->bindBufferIndexed(_uniformBuffer, 0u);
+		_uniformBuffer = _graphicsDevice->createStreamingBuffer(BufferBinding::Uniform, 2u * sizeof(Matrix4));
 	}
 
 	static void onWindowCreated(Window* window)
@@ -265,7 +266,7 @@ private:
 		app->initialise();
 		app->update();
 		app->deinitialise();
-		app->_isRunning = false;
+		app->_exitEvent.set();
 
 		return 0;
 	}